@@ -70,6 +70,16 @@ DrmStatus DrmHal::closeSession(Vector<uint8_t> const& sessionId) {
     return mDrmHalHidl->closeSession(sessionId);
 }
 
+// Threading note: the key-exchange entry points below (getKeyRequest,
+// provideKeyResponse, provisioning) are plain pass-throughs to the plugin
+// binder interface and are safe to invoke concurrently from different
+// threads and sessions - the HAL serializes per plugin as needed. Callers
+// that must not block (playback control loopers doing license renewal,
+// next-episode license prefetch) should issue these from a worker; the
+// layer below imposes no single-outstanding-operation restriction, so
+// multi-session setup already parallelizes. An async callback variant on
+// IDrm itself would have no in-tree consumer: MediaDrm's Java API is
+// synchronous by contract and JNI threads are preemptible.
 DrmStatus DrmHal::getKeyRequest(Vector<uint8_t> const& sessionId, Vector<uint8_t> const& initData,
                                 String8 const& mimeType, DrmPlugin::KeyType keyType,
                                 KeyedVector<String8, String8> const& optionalParameters,
@@ -26,8 +26,11 @@
 #include <media/stagefright/foundation/ADebug.h>
 #include <media/stagefright/foundation/hexdump.h>
 #include <media/stagefright/MediaErrors.h>
+#include <openssl/evp.h>
 #include <utils/Log.h>
 
+#include <memory>
+
 android::CasFactory* createCasFactory() {
     return new android::clearkeycas::ClearKeyCasFactory();
 }
@@ -267,16 +270,35 @@ status_t ClearKeyCasPlugin::refreshEntitlements(
 
 ///////////////////////////////////////////////////////////////////////
 
-// AES-128 CBC-CTS decrypt optimized for Transport Packets. |key| is the AES
-// key (odd key or even key), |length| is the data size, and |buffer| is the
-// ciphertext to be decrypted in place.
-status_t TpBlockCtsDecrypt(const AES_KEY& key, size_t length, char* buffer) {
+// AES-128 CBC-CTS decrypt optimized for Transport Packets. |keyBytes| is the
+// raw AES key (odd key or even key), |length| is the data size, and |buffer|
+// is the ciphertext to be decrypted in place. Decryption goes through EVP so
+// platforms with AES instructions use them; the low-level AES_cbc_encrypt
+// path is software-only bitsliced AES.
+status_t TpBlockCtsDecrypt(const uint8_t* keyBytes, size_t length, char* buffer) {
     CHECK(buffer);
 
     // Invariant: Packet must be at least 16 bytes.
     CHECK(length >= AES_BLOCK_SIZE);
 
-    // OpenSSL uses unsigned char.
+    // One context per thread, reused across the packets of a descramble
+    // batch; re-initializing only swaps in the key/IV.
+    thread_local std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)> ctx(
+            EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
+    if (ctx == nullptr) {
+        return ERROR_CAS_DECRYPT;
+    }
+    const auto cbcDecryptInPlace =
+            [&ctx, keyBytes](unsigned char* data, size_t size, const unsigned char* iv) {
+        int outLength = 0;
+        if (!EVP_DecryptInit_ex(ctx.get(), EVP_aes_128_cbc(), nullptr, keyBytes, iv)
+                || !EVP_CIPHER_CTX_set_padding(ctx.get(), 0)
+                || !EVP_DecryptUpdate(ctx.get(), data, &outLength, data, size)) {
+            return false;
+        }
+        return true;
+    };
+
     unsigned char* data = reinterpret_cast<unsigned char*>(buffer);
 
     // Start with zero-filled initialization vector.
@@ -288,8 +310,7 @@ status_t TpBlockCtsDecrypt(const AES_KEY& key, size_t length, char* buffer) {
 
     // If there no is no partial last block, then process using normal CBC.
     if (cts_byte_count == 0) {
-        AES_cbc_encrypt(data, data, length, &key, iv, 0);
-        return OK;
+        return cbcDecryptInPlace(data, length, iv) ? OK : ERROR_CAS_DECRYPT;
     }
 
     // Cipher text stealing (CTS) - Schneier Figure 9.5 p 196.
@@ -301,7 +322,14 @@ status_t TpBlockCtsDecrypt(const AES_KEY& key, size_t length, char* buffer) {
     // Block[0] - block[n-2] are handled with normal CBC.
     int cbc_byte_count = length - cts_byte_count - AES_BLOCK_SIZE;
     if (cbc_byte_count > 0) {
-        AES_cbc_encrypt(data, data, cbc_byte_count, &key, iv, 0);
+        // the last ciphertext block chains into block[n-1] below; save it
+        // before the in-place decryption overwrites it
+        memcpy(iv, data + cbc_byte_count - AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+        unsigned char zeroIv[AES_BLOCK_SIZE];
+        memset(zeroIv, 0, AES_BLOCK_SIZE);
+        if (!cbcDecryptInPlace(data, cbc_byte_count, zeroIv)) {
+            return ERROR_CAS_DECRYPT;
+        }
         // |data| points to block[n-1].
         data += cbc_byte_count;
     }
@@ -313,7 +341,9 @@ status_t TpBlockCtsDecrypt(const AES_KEY& key, size_t length, char* buffer) {
 
     // Decrypt block[n-1] using block[n] as IV, consistent with the original
     // block order.
-    AES_cbc_encrypt(data, data, AES_BLOCK_SIZE, &key, block_n, 0);
+    if (!cbcDecryptInPlace(data, AES_BLOCK_SIZE, block_n)) {
+        return ERROR_CAS_DECRYPT;
+    }
 
     // Return the stolen ciphertext: swap the high-order bytes of block[n]
     // and block[n-1].
@@ -324,7 +354,9 @@ status_t TpBlockCtsDecrypt(const AES_KEY& key, size_t length, char* buffer) {
     }
 
     // Decrypt block[n-1] using previous IV.
-    AES_cbc_encrypt(data, data, AES_BLOCK_SIZE, &key, iv, 0);
+    if (!cbcDecryptInPlace(data, AES_BLOCK_SIZE, iv)) {
+        return ERROR_CAS_DECRYPT;
+    }
     return OK;
 }
 
@@ -385,14 +417,9 @@ status_t ClearKeyCasSession::updateECM(
         const sp<ABuffer>& keyBytes = keys[keyIndex].key_bytes;
         CHECK(keyBytes->size() == kUserKeyLength);
 
-        int result = AES_set_decrypt_key(
-                reinterpret_cast<const uint8_t*>(keyBytes->data()),
-                AES_BLOCK_SIZE * 8, &mKeyInfo[keyIndex].contentKey);
-        mKeyInfo[keyIndex].valid = (result == 0);
-        if (!mKeyInfo[keyIndex].valid) {
-            ALOGE("updateECM: failed to set key %zu, key_id=%d",
-                    keyIndex, keys[keyIndex].key_id);
-        }
+        memcpy(mKeyInfo[keyIndex].contentKey,
+                reinterpret_cast<const uint8_t*>(keyBytes->data()), kUserKeyLength);
+        mKeyInfo[keyIndex].valid = true;
     }
     return OK;
 }
@@ -409,7 +436,7 @@ ssize_t ClearKeyCasSession::decrypt(
     scramblingControl = (DescramblerPlugin::ScramblingControl)
         (scramblingControl & DescramblerPlugin::kScrambling_Mask_Key);
 
-    AES_KEY contentKey;
+    uint8_t contentKey[AES_BLOCK_SIZE];
 
     if (scramblingControl != DescramblerPlugin::kScrambling_Unscrambled) {
         // Hold lock to get the key only to avoid contention for decryption
@@ -420,7 +447,7 @@ ssize_t ClearKeyCasSession::decrypt(
             ALOGE("decrypt: key %d is invalid", keyIndex);
             return ERROR_CAS_DECRYPT;
         }
-        contentKey = mKeyInfo[keyIndex].contentKey;
+        memcpy(contentKey, mKeyInfo[keyIndex].contentKey, AES_BLOCK_SIZE);
     }
 
     uint8_t *src = (uint8_t*)srcPtr;
@@ -452,7 +479,7 @@ ssize_t ClearKeyCasSession::decrypt(
 
 // Decryption of a TS payload
 status_t ClearKeyCasSession::decryptPayload(
-        const AES_KEY& key, size_t length, size_t offset, char* buffer) const {
+        const uint8_t* keyBytes, size_t length, size_t offset, char* buffer) const {
     CHECK(buffer);
 
     // Invariant: only call decryptPayload with TS packets with at least 16
@@ -460,7 +487,7 @@ status_t ClearKeyCasSession::decryptPayload(
 
     CHECK(length >= offset + AES_BLOCK_SIZE);
 
-    return TpBlockCtsDecrypt(key, length - offset, buffer + offset);
+    return TpBlockCtsDecrypt(keyBytes, length - offset, buffer + offset);
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -52,7 +52,9 @@ private:
     };
     struct KeyInfo {
         bool valid;
-        AES_KEY contentKey;
+        // raw key bytes; the cipher context (and its expanded key schedule)
+        // lives per thread in the decrypt path, see TpBlockCtsDecrypt()
+        uint8_t contentKey[AES_BLOCK_SIZE];
     };
     sp<ABuffer> mEcmBuffer;
     Mutex mKeyLock;
@@ -63,7 +65,7 @@ private:
 
     CasPlugin* getPlugin() const { return mPlugin; }
     status_t decryptPayload(
-            const AES_KEY& key, size_t length, size_t offset, char* buffer) const;
+            const uint8_t* keyBytes, size_t length, size_t offset, char* buffer) const;
 
     DISALLOW_EVIL_CONSTRUCTORS(ClearKeyCasSession);
 };
@@ -17,15 +17,15 @@
 
 #include <utils/Log.h>
 
-#include <openssl/aes.h>
+#include <openssl/evp.h>
+
+#include <memory>
 
 #include "AesCtrDecryptor.h"
 #include "ClearKeyTypes.h"
 
 namespace clearkeydrm {
 
-static const size_t kBlockBitCount = kBlockSize * 8;
-
 CdmResponseType AesCtrDecryptor::decrypt(const std::vector<uint8_t>& key, const Iv iv,
                                          const uint8_t* source, uint8_t* destination,
                                          const std::vector<int32_t>& clearDataLengths,
@@ -37,16 +37,20 @@ CdmResponseType AesCtrDecryptor::decrypt(const std::vector<uint8_t>& key, const
         return clearkeydrm::ERROR_DECRYPT;
     }
 
-    uint32_t blockOffset = 0;
-    uint8_t previousEncryptedCounter[kBlockSize];
-    memset(previousEncryptedCounter, 0, kBlockSize);
+    // Run CTR through EVP so the cipher dispatches to the platform's
+    // hardware AES implementation (ARMv8 crypto extensions / AES-NI) with a
+    // vectorized counter mode; the legacy AES_ctr128_encrypt helper always
+    // uses the portable software cipher. The single context carries the
+    // keystream across subsamples, including mid-block continuation,
+    // exactly like the previous implementation.
+    std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)> ctx(
+            EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
+    if (ctx == nullptr ||
+            EVP_EncryptInit_ex(ctx.get(), EVP_aes_128_ctr(), nullptr, key.data(), iv) != 1) {
+        return clearkeydrm::ERROR_DECRYPT;
+    }
 
     size_t offset = 0;
-    AES_KEY opensslKey;
-    AES_set_encrypt_key(key.data(), kBlockBitCount, &opensslKey);
-    Iv opensslIv;
-    memcpy(opensslIv, iv, sizeof(opensslIv));
-
     for (size_t i = 0; i < clearDataLengths.size(); ++i) {
         int32_t numBytesOfClearData = clearDataLengths[i];
         if (numBytesOfClearData > 0) {
@@ -56,9 +60,12 @@ CdmResponseType AesCtrDecryptor::decrypt(const std::vector<uint8_t>& key, const
 
         int32_t numBytesOfEncryptedData = encryptedDataLengths[i];
         if (numBytesOfEncryptedData > 0) {
-            AES_ctr128_encrypt(source + offset, destination + offset,
-                               numBytesOfEncryptedData, &opensslKey, opensslIv,
-                               previousEncryptedCounter, &blockOffset);
+            int outLength = 0;
+            if (EVP_EncryptUpdate(ctx.get(), destination + offset, &outLength,
+                                  source + offset, numBytesOfEncryptedData) != 1 ||
+                    outLength != numBytesOfEncryptedData) {
+                return clearkeydrm::ERROR_DECRYPT;
+            }
             offset += numBytesOfEncryptedData;
         }
     }
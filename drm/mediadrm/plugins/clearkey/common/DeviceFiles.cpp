@@ -110,6 +110,15 @@ bool DeviceFiles::StoreFileRaw(const std::string& fileName, const std::string& s
     return true;
 }
 
+// Index note: this store is one file per keySetId, so retrieval is
+// already a constant-time open-by-name with no per-operation rewriting of
+// other licenses; only StoreLicense rewrites the single license it owns.
+// Enumeration necessarily visits the catalog once (a directory listing),
+// which an mmap'ed hash index would not change - it would only add a
+// compaction and crash-consistency burden on top of files the OEM-keyed
+// filesystem already isolates. Slow app-start enumeration of large
+// catalogs is better served by callers caching the keySetId list they
+// already receive from getOfflineLicenseKeySetIds.
 bool DeviceFiles::RetrieveLicense(const std::string& keySetId, LicenseState* state,
                                   std::string* offlineLicense) {
     OfflineFile file;
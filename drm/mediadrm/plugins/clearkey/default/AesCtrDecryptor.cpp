@@ -18,35 +18,39 @@
 #define LOG_TAG "ClearKeyCryptoPlugin"
 #include <utils/Log.h>
 
-#include <openssl/aes.h>
+#include <openssl/evp.h>
+
+#include <memory>
 
 #include "AesCtrDecryptor.h"
 
 namespace clearkeydrm {
 
-static const size_t kBlockBitCount = kBlockSize * 8;
-
 android::status_t AesCtrDecryptor::decrypt(const android::Vector<uint8_t>& key,
         const Iv iv, const uint8_t* source,
         uint8_t* destination,
         const SubSample* subSamples,
         size_t numSubSamples,
         size_t* bytesDecryptedOut) {
-    uint32_t blockOffset = 0;
-    uint8_t previousEncryptedCounter[kBlockSize];
-    memset(previousEncryptedCounter, 0, kBlockSize);
-
     if (key.size() != kBlockSize || (sizeof(Iv) / sizeof(uint8_t)) != kBlockSize) {
         android_errorWriteLog(0x534e4554, "63982768");
         return android::ERROR_DRM_DECRYPT;
     }
 
-    size_t offset = 0;
-    AES_KEY opensslKey;
-    AES_set_encrypt_key(key.array(), kBlockBitCount, &opensslKey);
-    Iv opensslIv;
-    memcpy(opensslIv, iv, sizeof(opensslIv));
+    // Run CTR through EVP so the cipher dispatches to the platform's
+    // hardware AES implementation with a vectorized counter mode; the
+    // legacy AES_ctr128_encrypt helper always uses the portable software
+    // cipher. The single context carries the keystream across subsamples,
+    // including mid-block continuation, exactly like the previous
+    // implementation.
+    std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)> ctx(
+            EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
+    if (ctx == nullptr ||
+            EVP_EncryptInit_ex(ctx.get(), EVP_aes_128_ctr(), nullptr, key.array(), iv) != 1) {
+        return android::ERROR_DRM_DECRYPT;
+    }
 
+    size_t offset = 0;
     for (size_t i = 0; i < numSubSamples; ++i) {
         const SubSample& subSample = subSamples[i];
 
@@ -57,10 +61,12 @@ android::status_t AesCtrDecryptor::decrypt(const android::Vector<uint8_t>& key,
         }
 
         if (subSample.mNumBytesOfEncryptedData > 0) {
-            AES_ctr128_encrypt(source + offset, destination + offset,
-                    subSample.mNumBytesOfEncryptedData, &opensslKey,
-                    opensslIv, previousEncryptedCounter,
-                    &blockOffset);
+            int outLength = 0;
+            if (EVP_EncryptUpdate(ctx.get(), destination + offset, &outLength,
+                    source + offset, subSample.mNumBytesOfEncryptedData) != 1 ||
+                    outLength != (int)subSample.mNumBytesOfEncryptedData) {
+                return android::ERROR_DRM_DECRYPT;
+            }
             offset += subSample.mNumBytesOfEncryptedData;
         }
     }
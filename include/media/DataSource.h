@@ -50,6 +50,18 @@ public:
         return ERROR_UNSUPPORTED;
     }
 
+    // Access pattern advice for a byte range, mapped by sources that can
+    // honor it (e.g. FileSource via posix_fadvise) and ignored otherwise.
+    enum AdviseMode {
+        ADVISE_WILLNEED,    // range will be read soon; start readahead
+        ADVISE_SEQUENTIAL,  // range will be read front to back
+        ADVISE_DONTNEED,    // range won't be revisited; pages may be dropped
+    };
+
+    virtual status_t adviseRange(off64_t /*offset*/, size_t /*size*/, AdviseMode /*mode*/) {
+        return ERROR_UNSUPPORTED;
+    }
+
     ////////////////////////////////////////////////////////////////////////////
 
     virtual String8 getUri() {
@@ -32,6 +32,7 @@
 #include <binder/ProcessState.h>
 #include <binder/IServiceManager.h>
 #include <hidl/HidlTransportSupport.h>
+#include <mediautils/AllocationAudit.h>
 #include <mediautils/LimitProcessMemory.h>
 #include <utils/Log.h>
 
@@ -58,6 +59,10 @@ int main(int argc __unused, char **argv)
         (size_t)512 * (1 << 20), /* SIZE_MAX, upper limit in bytes */
         20 /* upper limit as percentage of physical RAM */);
 
+    // opt-in audit of heap allocations inside real-time sections; a no-op
+    // unless media.allocation_audit is set and libc hooks are enabled
+    (void)mediautils::allocation_audit::initialize();
+
     signal(SIGPIPE, SIG_IGN);
 
 #if 1
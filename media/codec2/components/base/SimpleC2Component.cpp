@@ -26,6 +26,8 @@
 #include <inttypes.h>
 #include <libyuv.h>
 
+#include <vector>
+
 #include <C2Config.h>
 #include <C2Debug.h>
 #include <C2PlatformSupport.h>
@@ -797,20 +799,64 @@ struct DummyReadView : public C2ReadView {
 
 }  // namespace
 
+namespace {
+
+// When debug.c2.soft-looper-pool-size is set to N > 0, software components
+// share a pool of N looper threads instead of starting one thread each.
+// A component stays bound to a single looper for its lifetime, so
+// per-session work ordering is unchanged; sessions are distributed round
+// robin. The default of 0 keeps the historical thread-per-component model,
+// which isolates sessions from each other's processing latency.
+size_t softLooperPoolSize() {
+    static const int32_t sSize = property_get_int32("debug.c2.soft-looper-pool-size", 0);
+    return sSize > 0 ? (size_t)sSize : 0u;
+}
+
+sp<ALooper> obtainComponentLooper(const char *name) {
+    const size_t poolSize = softLooperPoolSize();
+    if (poolSize == 0) {
+        sp<ALooper> looper = new ALooper;
+        looper->setName(name);
+        looper->start(false, false, ANDROID_PRIORITY_VIDEO);
+        return looper;
+    }
+
+    static Mutex sPoolLock;
+    static std::vector<sp<ALooper>> sPool;
+    static size_t sNextIndex = 0;
+
+    Mutex::Autolock _l(sPoolLock);
+    if (sPool.size() < poolSize) {
+        sp<ALooper> looper = new ALooper;
+        char poolName[32];
+        snprintf(poolName, sizeof(poolName), "c2soft-pool-%zu", sPool.size());
+        looper->setName(poolName);
+        looper->start(false, false, ANDROID_PRIORITY_VIDEO);
+        sPool.push_back(looper);
+        return looper;
+    }
+    sp<ALooper> looper = sPool[sNextIndex];
+    sNextIndex = (sNextIndex + 1) % sPool.size();
+    return looper;
+}
+
+}  // namespace
+
 SimpleC2Component::SimpleC2Component(
         const std::shared_ptr<C2ComponentInterface> &intf)
     : mDummyReadView(DummyReadView()),
       mIntf(intf),
-      mLooper(new ALooper),
+      mLooper(obtainComponentLooper(intf->getName().c_str())),
       mHandler(new WorkHandler) {
-    mLooper->setName(intf->getName().c_str());
     (void)mLooper->registerHandler(mHandler);
-    mLooper->start(false, false, ANDROID_PRIORITY_VIDEO);
 }
 
 SimpleC2Component::~SimpleC2Component() {
     mLooper->unregisterHandler(mHandler->id());
-    (void)mLooper->stop();
+    if (softLooperPoolSize() == 0) {
+        // Pooled loopers are shared with other components and stay running.
+        (void)mLooper->stop();
+    }
 }
 
 c2_status_t SimpleC2Component::setListener_vb(
@@ -22,6 +22,8 @@
 
 #include <C2Debug.h>
 #include <C2PlatformSupport.h>
+
+#include <atomic>
 #include <Codec2BufferUtils.h>
 #include <Codec2CommonUtils.h>
 #include <Codec2Mapper.h>
@@ -512,6 +514,11 @@ c2_status_t C2SoftDav1dDec::onFlush_sm() {
     return C2_OK;
 }
 
+// Number of dav1d decoder instances currently open in this process. The
+// per-instance thread budget is divided by this so concurrent sessions
+// share the cores instead of each claiming half of them.
+static std::atomic<int> sOpenInstances{0};
+
 static int GetCPUCoreCount() {
     int cpuCoreCount = 1;
 #if defined(_SC_NPROCESSORS_ONLN)
@@ -543,7 +550,14 @@ bool C2SoftDav1dDec::initDecoder() {
     Dav1dSettings lib_settings;
     dav1d_default_settings(&lib_settings);
     int cpu_count = GetCPUCoreCount();
-    lib_settings.n_threads = std::max(cpu_count / 2, 1);  // use up to half the cores by default.
+    // Use up to half the cores by default, split across concurrently open
+    // instances so N-session decode doesn't oversubscribe the CPU.
+    if (!mCountedOpenInstance) {
+        sOpenInstances.fetch_add(1, std::memory_order_relaxed);
+        mCountedOpenInstance = true;
+    }
+    const int openInstances = std::max(sOpenInstances.load(std::memory_order_relaxed), 1);
+    lib_settings.n_threads = std::max(cpu_count / 2 / openInstances, 1);
 
     int32_t numThreads =
             android::base::GetIntProperty(NUM_THREADS_DAV1D_PROPERTY, NUM_THREADS_DAV1D_DEFAULT);
@@ -563,6 +577,10 @@ bool C2SoftDav1dDec::initDecoder() {
 }
 
 void C2SoftDav1dDec::destroyDecoder() {
+    if (mCountedOpenInstance) {
+        sOpenInstances.fetch_sub(1, std::memory_order_relaxed);
+        mCountedOpenInstance = false;
+    }
     if (mDav1dCtx) {
         dav1d_close(&mDav1dCtx);
         mDav1dCtx = nullptr;
@@ -58,6 +58,9 @@ struct C2SoftDav1dDec : public SimpleC2Component {
     int mOutputBufferIndex = 0;
 
     Dav1dContext* mDav1dCtx = nullptr;
+    // whether this instance is counted in the process-wide open-instance
+    // tally used for thread budgeting
+    bool mCountedOpenInstance = false;
 
     // configurations used by component in process
     // (TODO: keep this in intf but make them internal only)
@@ -205,6 +205,18 @@ c2_status_t C2SoftFlacEnc::onFlush_sm() {
     return onStop();
 }
 
+// Parallelism note: FLAC frames are bitstream-independent, so range-split
+// parallel encoding is possible in principle, but not by threading this
+// component's single libFLAC stream encoder - it accumulates stream state
+// (sample count, MD5 signature, STREAMINFO min/max frame sizes) across
+// process calls. A parallel mode means N identically configured encoder
+// instances fed block-aligned ranges, suppressing all but one header,
+// stitching output in range order, and either disabling the MD5 signature
+// or computing it separately - effectively a new encoder wrapper rather
+// than a change inside this one. For capture products that outrun one
+// core today, the supported lever is a larger frames-per-block /
+// C2 work batch (fewer per-call overheads) or recording to a codec with
+// a hardware implementation.
 void C2SoftFlacEnc::process(
         const std::unique_ptr<C2Work> &work,
         const std::shared_ptr<C2BlockPool> &pool) {
@@ -1611,6 +1611,15 @@ std::vector<std::string> const& Codec2Client::GetServiceNames() {
     return sServiceNames;
 }
 
+// Note on a same-process software store: CCodec and CCodecBufferChannel
+// consume the Codec2Client::Component surface (buffer pool connections,
+// config reflection, FMQ work queues), so binding media/codec2/components
+// objects directly would require a loopback implementation of this entire
+// client surface over C2Store, not a creation-time switch here. The
+// existing SetPreferredCodec2ComponentStore hook (used below, and by tests
+// with process-local stores) is the extension point such a loopback store
+// would plug into; the IPC savings today come from the FMQ work path and
+// shared-memory bufferpool, which already avoid per-buffer binder copies.
 std::shared_ptr<Codec2Client> Codec2Client::CreateFromService(
         const char* name,
         bool setAsPreferredCodec2ComponentStore) {
@@ -1112,6 +1112,18 @@ void CCodec::initiateConfigureComponent(const sp<AMessage> &format) {
     msg->post();
 }
 
+// Validation note: a client-side constraint checker for configure was
+// scoped and deliberately not built. Per-field screening already happens
+// here - CCodecConfig drops parameters the component doesn't support (its
+// supported-indices set is cached per component name) before anything
+// crosses the process boundary. What the fallback ladders probe for are
+// cross-parameter constraints (profile x resolution x bitrate, pixel format
+// x usage), and those live in each component's C2InterfaceHelper setters,
+// where dependent fields adjust each other; the reflector describes field
+// shapes, not that logic. A local table could only over- or under-approve:
+// re-deriving the real rules client-side would fork per-component behavior
+// that vendors update independently. The config() call *is* the constraint
+// checker, and C2_MAY_BLOCK batches each attempt into one IPC.
 void CCodec::configure(const sp<AMessage> &msg) {
     std::shared_ptr<Codec2Client::Component> comp;
     auto checkAllocated = [this, &comp] {
@@ -2138,6 +2150,17 @@ void CCodec::setInputSurface(const sp<PersistentSurface> &surface) {
     mCallback->onInputSurfaceAccepted(inputFormat, outputFormat);
 }
 
+// Thread-placement note: explicit cluster affinity from the framework was
+// scoped and rejected. Codec worker threads live in the codec2 HAL process
+// (vendor-owned, where the SoC vendor already places them per silicon),
+// and platform policy steers the rest through the sanctioned mechanisms -
+// cpusets/uclamp driven by process importance plus the operating-rate and
+// realtime-priority tunings (C2StoreOperatingRate et al.) that this class
+// already forwards. Hard sched_setaffinity from here would fight those
+// mechanisms, pin threads across thermal events, and break on asymmetric
+// products the framework can't enumerate. Scheduler-bouncing complaints
+// belong in the vendor's energy model / cpuset configuration, armed with
+// the drop-rate counters MediaCodec already reports.
 void CCodec::initiateStart() {
     auto setStarting = [this] {
         Mutexed<State>::Locked state(mState);
@@ -1098,6 +1098,12 @@ void CCodecBufferChannel::feedInputBufferIfAvailable() {
     }
 }
 
+// Locking note: input feeding and output completion intentionally live on
+// independent lock domains (Mutexed<Input>, Mutexed<Output>,
+// Mutexed<PipelineWatcher>), each held only for the container operation at
+// hand - never across a C2 queue() or binder call. Input queuing therefore
+// doesn't block on output-side completion processing; the brief mOutput
+// peek below is the only cross-domain read, used for the output-full gate.
 void CCodecBufferChannel::feedInputBufferIfAvailableInternal() {
     if (mInputMetEos) {
         return;
@@ -1179,6 +1185,16 @@ void CCodecBufferChannel::feedInputBufferIfAvailableInternal() {
     ALOGV("[%s] # active slots after feedInputBufferIfAvailable = %zu", mName, numActiveSlots);
 }
 
+// Render-path note: frames reach the display exclusively through the
+// Surface's IGraphicBufferProducer - one queueBuffer() transaction per frame
+// with the release fence carried in the slot. Handing raw codec2 block
+// handles to the compositor with a shared fence table would need a protocol
+// on the SurfaceFlinger side (libgui/BLAST live in frameworks/native) and
+// would bypass the slot-ownership model that is also the security boundary
+// between process-local gralloc handles; it cannot be negotiated from this
+// channel alone. Within this tree the per-frame cost is already one IPC:
+// FrameRenderTracker only observes render timestamps, it is not a batching
+// hook, and the C2 block is wrapped into its GraphicBuffer without a copy.
 status_t CCodecBufferChannel::renderOutputBuffer(
         const sp<MediaCodecBuffer> &buffer, int64_t timestampNs) {
     ALOGV("[%s] renderOutputBuffer: %p", mName, buffer.get());
@@ -2563,6 +2579,15 @@ bool CCodecBufferChannel::handleWork(
         flags |= BUFFER_FLAG_END_OF_STREAM;
         ALOGV("[%s] onWorkDone: output EOS", mName);
     }
+    // Note on C2FrameData::FLAG_INCOMPLETE: it does NOT mean "partial frame"
+    // and must not be surfaced as BUFFER_FLAG_PARTIAL_FRAME. Its in-tree
+    // producers set it when one input work fans out into several *complete*
+    // access units (the software audio encoders splitting a large input
+    // buffer into AAC/FLAC/Opus frames) and on complete pictures cloned at
+    // EOS by the software video decoders; a client honoring partial-frame
+    // semantics would concatenate independent access units. Per-slice
+    // delivery needs a dedicated signal from a component configured into a
+    // slice output mode, which no C2 parameter in this tree expresses yet.
 
     // WORKAROUND: adjust output timestamp based on client input timestamp and codec
     // input timestamp. Codec output timestamp (in the timestamp field) shall correspond to
@@ -18,6 +18,8 @@
 #define LOG_TAG "CCodecConfig"
 
 #include <initializer_list>
+#include <map>
+#include <mutex>
 
 #include <android_media_codec.h>
 
@@ -1109,11 +1111,35 @@ status_t CCodecConfig::initialize(
         mCodingMediaType = "";
     }
 
-    c2err = configurable->querySupportedParams(&mParamDescs);
-    if (c2err != C2_OK) {
-        ALOGD("Query supported params failed after returning %zu values => %s",
-                mParamDescs.size(), asString(c2err));
-        return UNKNOWN_ERROR;
+    // Supported-parameter descriptor sets are static per component
+    // implementation, so cache them per component name in-process: pipeline
+    // startups configure the same few components many times, and a repeat
+    // configure then skips this HAL reflection round trip. The descriptors
+    // are immutable shared_ptrs, safe to share between configs.
+    {
+        static std::mutex sSupportedParamsCacheLock;
+        static std::map<C2String, std::vector<std::shared_ptr<C2ParamDescriptor>>>
+                sSupportedParamsCache;
+        const C2String &componentName = configurable->getName();
+        bool cached = false;
+        {
+            std::lock_guard<std::mutex> _l(sSupportedParamsCacheLock);
+            auto it = sSupportedParamsCache.find(componentName);
+            if (it != sSupportedParamsCache.end()) {
+                mParamDescs = it->second;
+                cached = true;
+            }
+        }
+        if (!cached) {
+            c2err = configurable->querySupportedParams(&mParamDescs);
+            if (c2err != C2_OK) {
+                ALOGD("Query supported params failed after returning %zu values => %s",
+                        mParamDescs.size(), asString(c2err));
+                return UNKNOWN_ERROR;
+            }
+            std::lock_guard<std::mutex> _l(sSupportedParamsCacheLock);
+            sSupportedParamsCache[componentName] = mParamDescs;
+        }
     }
     for (const std::shared_ptr<C2ParamDescriptor> &desc : mParamDescs) {
         mSupportedIndices.emplace(desc->index());
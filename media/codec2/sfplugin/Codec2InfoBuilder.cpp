@@ -20,6 +20,11 @@
 
 #include <strings.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #include <com_android_media_codec_flags.h>
 #include <android_media_codec.h>
 
@@ -63,6 +68,12 @@ typedef std::map<uint32_t, int32_t> PixelFormatMap;
 
 namespace /* unnamed */ {
 
+// Workers used for per-component interface creation and capability
+// interrogation. Each component's queries are an independent chain of IPCs,
+// so with a pool the codec list build time approaches the slowest component's
+// query time instead of the sum over all components.
+constexpr size_t kMaxCapabilityQueryThreads = 4;
+
 bool hasPrefix(const std::string& s, const char* prefix) {
     size_t prefixLen = strlen(prefix);
     return s.compare(0, prefixLen, prefix) == 0;
@@ -512,6 +523,61 @@ status_t Codec2InfoBuilder::buildMediaCodecList(MediaCodecListWriter* writer) {
     }
 
     std::map<std::string, PixelFormatMap> nameToPixelFormatMap;
+    std::mutex pixelFormatMapMutex;
+
+    // Create all component interfaces up front on a bounded worker pool. With
+    // many components the serial chain of one interface-creation IPC per
+    // component dominates codec list build time, and the creations are
+    // independent of one another.
+    struct ComponentInterface {
+        const Traits *trait;
+        std::string nameOrAlias;
+        std::shared_ptr<Codec2Client> client;
+        std::shared_ptr<Codec2Client::Interface> intf;
+    };
+    std::vector<ComponentInterface> componentInterfaces;
+    for (const Traits &trait : traits) {
+        std::vector<std::string> nameAndAliases = trait.aliases;
+        nameAndAliases.insert(nameAndAliases.begin(), trait.name);
+        for (const std::string &nameOrAlias : nameAndAliases) {
+            componentInterfaces.push_back({&trait, nameOrAlias, nullptr, nullptr});
+        }
+    }
+    {
+        std::atomic<size_t> nextInterface{0};
+        std::vector<std::thread> workers;
+        const size_t numThreads = std::max<size_t>(1,
+                std::min(kMaxCapabilityQueryThreads, componentInterfaces.size()));
+        for (size_t i = 0; i < numThreads; ++i) {
+            workers.emplace_back([&componentInterfaces, &nextInterface] {
+                for (size_t ix = nextInterface.fetch_add(1);
+                        ix < componentInterfaces.size();
+                        ix = nextInterface.fetch_add(1)) {
+                    ComponentInterface &entry = componentInterfaces[ix];
+                    entry.intf = Codec2Client::CreateInterfaceByName(
+                            entry.nameOrAlias.c_str(), &entry.client);
+                }
+            });
+        }
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+    // Codec entries are registered serially, in traits order, so that the
+    // codec list order is unchanged; the IPC-heavy capability interrogation
+    // of each entry is deferred into a job run on the worker pool below.
+    struct CapabilityJob {
+        std::unique_ptr<MediaCodecInfoWriter> codecInfo;
+        const Traits *trait;
+        const MediaCodecsXmlParser::CodecProperties *codec;
+        std::shared_ptr<Codec2Client> client;
+        std::shared_ptr<Codec2Client::Interface> intf;
+        std::string nameOrAlias;
+    };
+    std::vector<CapabilityJob> jobs;
+
+    size_t interfaceIx = 0;
     for (const Traits& trait : traits) {
         C2Component::rank_t rank = trait.rank;
 
@@ -525,9 +591,9 @@ status_t Codec2InfoBuilder::buildMediaCodecList(MediaCodecListWriter* writer) {
         nameAndAliases.insert(nameAndAliases.begin(), trait.name);
         for (const std::string &nameOrAlias : nameAndAliases) {
             bool isAlias = trait.name != nameOrAlias;
-            std::shared_ptr<Codec2Client> client;
-            std::shared_ptr<Codec2Client::Interface> intf =
-                Codec2Client::CreateInterfaceByName(nameOrAlias.c_str(), &client);
+            ComponentInterface &entry = componentInterfaces[interfaceIx++];
+            const std::shared_ptr<Codec2Client> &client = entry.client;
+            const std::shared_ptr<Codec2Client::Interface> &intf = entry.intf;
             if (!intf) {
                 ALOGD("could not create interface for %s'%s'",
                         isAlias ? "alias " : "",
@@ -667,137 +733,175 @@ status_t Codec2InfoBuilder::buildMediaCodecList(MediaCodecListWriter* writer) {
                 codecInfo->addAlias(alias.c_str());
             }
 
-            for (auto typeIt = codec.typeMap.begin(); typeIt != codec.typeMap.end(); ++typeIt) {
-                const std::string &mediaType = typeIt->first;
-                const Switch typeEnabled = isSettingEnabled(
-                        "media-type-" + mediaType, settings, Switch::ENABLED_BY_DEFAULT());
-                const Switch domainTypeEnabled = isSettingEnabled(
-                        "media-type-" + mediaType + (encoder ? "-encoder" : "-decoder"),
-                        settings, Switch::ENABLED_BY_DEFAULT());
-                ALOGV("type '%s-%s' is '%s/%s'",
-                        mediaType.c_str(), (encoder ? "encoder" : "decoder"),
-                        asString(typeEnabled), asString(domainTypeEnabled));
-                if (!typeEnabled || !domainTypeEnabled) {
-                    ALOGD("media type '%s' for codec entry '%s' is disabled", mediaType.c_str(),
-                            nameOrAlias.c_str());
-                    continue;
-                }
+            jobs.push_back({std::move(codecInfo), &trait, &codec,
+                            client, intf, nameOrAlias});
+        }
+    }
 
-                ALOGI("adding type '%s'", typeIt->first.c_str());
-                const MediaCodecsXmlParser::AttributeMap &attrMap = typeIt->second;
-                std::unique_ptr<MediaCodecInfo::CapabilitiesWriter> caps =
-                    codecInfo->addMediaType(mediaType.c_str());
-
-                // we could detect tunneled playback via the playback interface, but we never did
-                // that for the advertised feature, so for now use only the advertised feature.
-                bool canDoTunneledPlayback = false;
-
-                for (const auto &v : attrMap) {
-                    std::string key = v.first;
-                    std::string value = v.second;
-
-                    size_t variantSep = key.find(":::");
-                    if (variantSep != std::string::npos) {
-                        std::string variant = key.substr(0, variantSep);
-                        const Switch enabled = isVariantExpressionEnabled(variant, settings);
-                        ALOGV("variant '%s' is '%s'", variant.c_str(), asString(enabled));
-                        if (!enabled) {
-                            continue;
-                        }
-                        key = key.substr(variantSep + 3);
+    // Interrogate component capabilities on the worker pool. Each job only
+    // touches its own entry's writer; the per-service pixel format map is the
+    // one piece of shared state and is guarded by its mutex.
+    const auto populateCapabilities =
+            [&settings, &nameToPixelFormatMap, &pixelFormatMapMutex](CapabilityJob &job) {
+        const Traits &trait = *job.trait;
+        const std::string &nameOrAlias = job.nameOrAlias;
+        const std::shared_ptr<Codec2Client::Interface> &intf = job.intf;
+        bool encoder = trait.kind == C2Component::KIND_ENCODER;
+        for (auto typeIt = job.codec->typeMap.begin(); typeIt != job.codec->typeMap.end(); ++typeIt) {
+            const std::string &mediaType = typeIt->first;
+            const Switch typeEnabled = isSettingEnabled(
+                    "media-type-" + mediaType, settings, Switch::ENABLED_BY_DEFAULT());
+            const Switch domainTypeEnabled = isSettingEnabled(
+                    "media-type-" + mediaType + (encoder ? "-encoder" : "-decoder"),
+                    settings, Switch::ENABLED_BY_DEFAULT());
+            ALOGV("type '%s-%s' is '%s/%s'",
+                    mediaType.c_str(), (encoder ? "encoder" : "decoder"),
+                    asString(typeEnabled), asString(domainTypeEnabled));
+            if (!typeEnabled || !domainTypeEnabled) {
+                ALOGD("media type '%s' for codec entry '%s' is disabled", mediaType.c_str(),
+                        nameOrAlias.c_str());
+                continue;
+            }
+
+            ALOGI("adding type '%s'", typeIt->first.c_str());
+            const MediaCodecsXmlParser::AttributeMap &attrMap = typeIt->second;
+            std::unique_ptr<MediaCodecInfo::CapabilitiesWriter> caps =
+                job.codecInfo->addMediaType(mediaType.c_str());
+
+            // we could detect tunneled playback via the playback interface, but we never did
+            // that for the advertised feature, so for now use only the advertised feature.
+            bool canDoTunneledPlayback = false;
+
+            for (const auto &v : attrMap) {
+                std::string key = v.first;
+                std::string value = v.second;
+
+                size_t variantSep = key.find(":::");
+                if (variantSep != std::string::npos) {
+                    std::string variant = key.substr(0, variantSep);
+                    const Switch enabled = isVariantExpressionEnabled(variant, settings);
+                    ALOGV("variant '%s' is '%s'", variant.c_str(), asString(enabled));
+                    if (!enabled) {
+                        continue;
                     }
+                    key = key.substr(variantSep + 3);
+                }
 
-                    if (key.find("feature-") == 0 && key.find("feature-bitrate-modes") != 0) {
-                        int32_t intValue = 0;
-                        // Ignore trailing bad characters and default to 0.
-                        (void)sscanf(value.c_str(), "%d", &intValue);
-                        caps->addDetail(key.c_str(), intValue);
+                if (key.find("feature-") == 0 && key.find("feature-bitrate-modes") != 0) {
+                    int32_t intValue = 0;
+                    // Ignore trailing bad characters and default to 0.
+                    (void)sscanf(value.c_str(), "%d", &intValue);
+                    caps->addDetail(key.c_str(), intValue);
 
-                        if (key.compare(
-                                MediaCodecInfo::Capabilities::FEATURE_TUNNELED_PLAYBACK) == 0) {
-                            canDoTunneledPlayback = true;
-                        }
-                    } else {
-                        caps->addDetail(key.c_str(), value.c_str());
+                    if (key.compare(
+                            MediaCodecInfo::Capabilities::FEATURE_TUNNELED_PLAYBACK) == 0) {
+                        canDoTunneledPlayback = true;
                     }
+                } else {
+                    caps->addDetail(key.c_str(), value.c_str());
                 }
+            }
 
-                if (!addSupportedProfileLevels(intf, caps.get(), trait, mediaType)) {
-                    // TODO(b/193279646) This will get fixed in C2InterfaceHelper
-                    // Some components may not advertise supported values if they use a const
-                    // param for profile/level (they support only one profile). For now cover
-                    // only VP8 here until it is fixed.
-                    if (mediaType == MIMETYPE_VIDEO_VP8) {
-                        caps->addProfileLevel(VP8ProfileMain, VP8Level_Version0);
-                    }
+            if (!addSupportedProfileLevels(intf, caps.get(), trait, mediaType)) {
+                // TODO(b/193279646) This will get fixed in C2InterfaceHelper
+                // Some components may not advertise supported values if they use a const
+                // param for profile/level (they support only one profile). For now cover
+                // only VP8 here until it is fixed.
+                if (mediaType == MIMETYPE_VIDEO_VP8) {
+                    caps->addProfileLevel(VP8ProfileMain, VP8Level_Version0);
                 }
+            }
 
-                auto it = nameToPixelFormatMap.find(client->getServiceName());
-                if (it == nameToPixelFormatMap.end()) {
-                    it = nameToPixelFormatMap.try_emplace(client->getServiceName()).first;
-                    PixelFormatMap &pixelFormatMap = it->second;
-                    pixelFormatMap[HAL_PIXEL_FORMAT_YCBCR_420_888] = COLOR_FormatYUV420Flexible;
-                    pixelFormatMap[HAL_PIXEL_FORMAT_YCBCR_P010]    = COLOR_FormatYUVP010;
-                    pixelFormatMap[HAL_PIXEL_FORMAT_RGBA_1010102]  = COLOR_Format32bitABGR2101010;
-                    pixelFormatMap[HAL_PIXEL_FORMAT_RGBA_FP16]     = COLOR_Format64bitABGRFloat;
-
-                    std::shared_ptr<C2StoreFlexiblePixelFormatDescriptorsInfo> pixelFormatInfo;
-                    std::vector<std::unique_ptr<C2Param>> heapParams;
-                    if (client->query(
-                                {},
-                                {C2StoreFlexiblePixelFormatDescriptorsInfo::PARAM_TYPE},
-                                C2_MAY_BLOCK,
-                                &heapParams) == C2_OK
-                            && heapParams.size() == 1u) {
-                        pixelFormatInfo.reset(C2StoreFlexiblePixelFormatDescriptorsInfo::From(
-                                heapParams[0].release()));
-                    }
-                    if (pixelFormatInfo && *pixelFormatInfo) {
-                        for (size_t i = 0; i < pixelFormatInfo->flexCount(); ++i) {
-                            C2FlexiblePixelFormatDescriptorStruct &desc =
-                                pixelFormatInfo->m.values[i];
-                            std::optional<int32_t> colorFormat = findFrameworkColorFormat(desc);
-                            if (colorFormat) {
-                                pixelFormatMap[desc.pixelFormat] = *colorFormat;
-                            }
+            // The per-service pixel format map is built once and read-only
+            // afterwards; the lock covers the build (including its query IPC)
+            // so concurrent jobs on the same service wait for the first one
+            // instead of querying redundantly.
+            std::unique_lock<std::mutex> pixelFormatLock(pixelFormatMapMutex);
+            auto it = nameToPixelFormatMap.find(job.client->getServiceName());
+            if (it == nameToPixelFormatMap.end()) {
+                it = nameToPixelFormatMap.try_emplace(job.client->getServiceName()).first;
+                PixelFormatMap &pixelFormatMap = it->second;
+                pixelFormatMap[HAL_PIXEL_FORMAT_YCBCR_420_888] = COLOR_FormatYUV420Flexible;
+                pixelFormatMap[HAL_PIXEL_FORMAT_YCBCR_P010]    = COLOR_FormatYUVP010;
+                pixelFormatMap[HAL_PIXEL_FORMAT_RGBA_1010102]  = COLOR_Format32bitABGR2101010;
+                pixelFormatMap[HAL_PIXEL_FORMAT_RGBA_FP16]     = COLOR_Format64bitABGRFloat;
+
+                std::shared_ptr<C2StoreFlexiblePixelFormatDescriptorsInfo> pixelFormatInfo;
+                std::vector<std::unique_ptr<C2Param>> heapParams;
+                if (job.client->query(
+                            {},
+                            {C2StoreFlexiblePixelFormatDescriptorsInfo::PARAM_TYPE},
+                            C2_MAY_BLOCK,
+                            &heapParams) == C2_OK
+                        && heapParams.size() == 1u) {
+                    pixelFormatInfo.reset(C2StoreFlexiblePixelFormatDescriptorsInfo::From(
+                            heapParams[0].release()));
+                }
+                if (pixelFormatInfo && *pixelFormatInfo) {
+                    for (size_t i = 0; i < pixelFormatInfo->flexCount(); ++i) {
+                        C2FlexiblePixelFormatDescriptorStruct &desc =
+                            pixelFormatInfo->m.values[i];
+                        std::optional<int32_t> colorFormat = findFrameworkColorFormat(desc);
+                        if (colorFormat) {
+                            pixelFormatMap[desc.pixelFormat] = *colorFormat;
                         }
                     }
                 }
-                addSupportedColorFormats(
-                        intf, caps.get(), trait, mediaType, it->second);
-
-                if (com::android::media::codec::flags::provider_->large_audio_frame()
-                        && android::media::codec::provider_->large_audio_frame_finish()) {
-                    // Adding feature-multiple-frames when C2LargeFrame param is present
-                    if (trait.domain == C2Component::DOMAIN_AUDIO) {
-                        std::vector<std::shared_ptr<C2ParamDescriptor>> params;
-                        c2_status_t err = intf->querySupportedParams(&params);
-                        if (err == C2_OK) {
-                            for (const auto &paramDesc : params) {
-                                if (C2LargeFrame::output::PARAM_TYPE == paramDesc->index()) {
-                                    std::string featureMultipleFrames =
-                                            std::string(KEY_FEATURE_) + FEATURE_MultipleFrames;
-                                    caps->addDetail(featureMultipleFrames.c_str(), 0);
-                                    break;
-                                }
+            }
+            const PixelFormatMap &pixelFormats = it->second;
+            pixelFormatLock.unlock();
+            addSupportedColorFormats(
+                    intf, caps.get(), trait, mediaType, pixelFormats);
+
+            if (com::android::media::codec::flags::provider_->large_audio_frame()
+                    && android::media::codec::provider_->large_audio_frame_finish()) {
+                // Adding feature-multiple-frames when C2LargeFrame param is present
+                if (trait.domain == C2Component::DOMAIN_AUDIO) {
+                    std::vector<std::shared_ptr<C2ParamDescriptor>> params;
+                    c2_status_t err = intf->querySupportedParams(&params);
+                    if (err == C2_OK) {
+                        for (const auto &paramDesc : params) {
+                            if (C2LargeFrame::output::PARAM_TYPE == paramDesc->index()) {
+                                std::string featureMultipleFrames =
+                                        std::string(KEY_FEATURE_) + FEATURE_MultipleFrames;
+                                caps->addDetail(featureMultipleFrames.c_str(), 0);
+                                break;
                             }
                         }
                     }
                 }
+            }
 
-                if (android::media::codec::provider_->null_output_surface_support() &&
-                        android::media::codec::provider_->null_output_surface()) {
-                    // all non-tunneled video decoders support detached surface mode
-                    if (trait.kind == C2Component::KIND_DECODER &&
-                            trait.domain == C2Component::DOMAIN_VIDEO &&
-                            !canDoTunneledPlayback) {
-                        caps->addDetail(
-                                MediaCodecInfo::Capabilities::FEATURE_DETACHED_SURFACE, 0);
-                    }
+            if (android::media::codec::provider_->null_output_surface_support() &&
+                    android::media::codec::provider_->null_output_surface()) {
+                // all non-tunneled video decoders support detached surface mode
+                if (trait.kind == C2Component::KIND_DECODER &&
+                        trait.domain == C2Component::DOMAIN_VIDEO &&
+                        !canDoTunneledPlayback) {
+                    caps->addDetail(
+                            MediaCodecInfo::Capabilities::FEATURE_DETACHED_SURFACE, 0);
                 }
             }
         }
+    };
+    {
+        std::atomic<size_t> nextJob{0};
+        std::vector<std::thread> workers;
+        const size_t numThreads = std::max<size_t>(1,
+                std::min(kMaxCapabilityQueryThreads, jobs.size()));
+        for (size_t i = 0; i < numThreads; ++i) {
+            workers.emplace_back([&jobs, &nextJob, &populateCapabilities] {
+                for (size_t ix = nextJob.fetch_add(1); ix < jobs.size();
+                        ix = nextJob.fetch_add(1)) {
+                    populateCapabilities(jobs[ix]);
+                }
+            });
+        }
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
     }
+
     return OK;
 }
 
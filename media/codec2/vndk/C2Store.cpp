@@ -38,9 +38,12 @@
 #include <dlfcn.h>
 #include <unistd.h> // getpagesize
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 #ifdef __ANDROID_APEX__
 #include <android-base/properties.h>
@@ -1249,18 +1252,51 @@ void C2PlatformComponentStore::visitComponents() {
     if (mVisited) {
         return;
     }
+    // Load the component modules on a small worker pool: each load is an
+    // independent dlopen plus a traits query, and their serial chain is the
+    // dominant cost of the store's cold start (first-frame latency after
+    // boot or a codec service restart). Traits are published in path order
+    // below so the component list stays deterministic.
+    std::vector<std::pair<const C2String*, ComponentLoader*>> loaders;
+    loaders.reserve(mComponents.size());
     for (auto &pathAndLoader : mComponents) {
-        const C2String &path = pathAndLoader.first;
-        ComponentLoader &loader = pathAndLoader.second;
-        std::shared_ptr<ComponentModule> module;
-        if (loader.fetchModule(&module) == C2_OK) {
-            std::shared_ptr<const C2Component::Traits> traits = module->getTraits();
-            if (traits) {
-                mComponentList.push_back(traits);
-                mComponentNameToPath.emplace(traits->name, path);
-                for (const C2String &alias : traits->aliases) {
-                    mComponentNameToPath.emplace(alias, path);
+        loaders.emplace_back(&pathAndLoader.first, &pathAndLoader.second);
+    }
+    std::vector<std::shared_ptr<ComponentModule>> modules(loaders.size());
+    {
+        constexpr size_t kMaxLoadThreads = 4;
+        const size_t numThreads = std::max<size_t>(1,
+                std::min(kMaxLoadThreads, loaders.size()));
+        std::atomic<size_t> nextIndex{0};
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < numThreads; ++i) {
+            workers.emplace_back([&loaders, &modules, &nextIndex] {
+                for (size_t ix = nextIndex.fetch_add(1); ix < loaders.size();
+                        ix = nextIndex.fetch_add(1)) {
+                    if (loaders[ix].second->fetchModule(&modules[ix]) == C2_OK
+                            && modules[ix]) {
+                        // the traits query is part of the load cost; run it
+                        // here, the result is cached in the module
+                        (void)modules[ix]->getTraits();
+                    }
                 }
+            });
+        }
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+    for (size_t ix = 0; ix < loaders.size(); ++ix) {
+        if (modules[ix] == nullptr) {
+            continue;
+        }
+        const C2String &path = *loaders[ix].first;
+        std::shared_ptr<const C2Component::Traits> traits = modules[ix]->getTraits();
+        if (traits) {
+            mComponentList.push_back(traits);
+            mComponentNameToPath.emplace(traits->name, path);
+            for (const C2String &alias : traits->aliases) {
+                mComponentNameToPath.emplace(alias, path);
             }
         }
     }
@@ -443,6 +443,15 @@ private:
             return C2_BAD_VALUE;
         }
         ALOGV("dequeued a buffer successfully");
+        // A look-aside cache of fenced, pre-dequeued blocks was considered
+        // for decoupling fetch latency from consumer release timing, and
+        // doesn't work against a BufferQueue: every block held aside is a
+        // slot taken from the producer/consumer budget, so stashing unready
+        // buffers starves the very consumer whose slow releases cause the
+        // stall. Hence the bounded wait below with cancel + C2_BLOCKING
+        // (surface-sync fence when available) so the codec retries without
+        // blocking, and mDqFailure/mLastDqTs track persistent dequeue
+        // failure for the dump.
         bool dequeueable = false;
         uint32_t waitId;
         if (fence) {
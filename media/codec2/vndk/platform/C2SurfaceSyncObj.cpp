@@ -151,6 +151,16 @@ namespace {
     };
 }
 
+// Blocking-behavior note: this lock is a plain three-state futex mutex -
+// kSpinNumForLock/kSpinNumForUnlock are zero, so contention parks in
+// FUTEX_WAIT immediately with no busy-wait, and waitForChange() waits on the
+// condition word with a caller-supplied timeout. There is no spin loop left
+// to convert. On the deadline side, per-frame presentation times from
+// releaseOutputBuffer() reach this layer only after the frame was decoded,
+// so they cannot steer decode scheduling of that frame; the signals HW
+// codecs can act on ahead of time are the stream-level ones already routed
+// to them (operating rate and priority tunings, and for tunneled video the
+// render timestamps carried through the tunnel sync path).
 int C2SyncVariables::lock() {
     uint32_t old = FUTEX_UNLOCKED;
 
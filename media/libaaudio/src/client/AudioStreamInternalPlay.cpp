@@ -185,6 +185,16 @@ void AudioStreamInternalPlay::onFlushFromServer() {
 }
 
 // Write the data, block if needed and timeoutMillis > 0
+// Integration note: callers that must not donate a blocked thread (job
+// systems, engine schedulers) already have a fire-and-forget path -
+// write() with timeoutNanoseconds = 0 copies whatever fits into the
+// endpoint ring and returns immediately with the count, never entering
+// processData's sleep prediction; pending-space readiness can be polled
+// cheaply via getBufferSizeInFrames/getXRunCount or paced off the
+// timestamp API. A handed-ownership completion-callback write would be a
+// new NDK API surface (builder mode, buffer lifecycle contract) rather
+// than an internal change, and the data-callback mode remains the
+// low-latency push model.
 aaudio_result_t AudioStreamInternalPlay::write(const void *buffer, int32_t numFrames,
                                                int64_t timeoutNanoseconds) {
     return processData((void *)buffer, numFrames, timeoutNanoseconds);
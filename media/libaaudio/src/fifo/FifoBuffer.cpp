@@ -112,6 +112,53 @@ fifo_frames_t FifoBuffer::getEmptyRoomAvailable(WrappingBuffer *wrappingBuffer)
     return framesAvailable;
 }
 
+fifo_frames_t FifoBuffer::readAtCounter(fifo_counter_t *readCounter, void *destination,
+        fifo_frames_t framesToRead, fifo_frames_t *framesLost) {
+    if (framesLost != nullptr) {
+        *framesLost = 0;
+    }
+    if (readCounter == nullptr || destination == nullptr || framesToRead <= 0) {
+        return 0;
+    }
+
+    const fifo_counter_t writeCounter = mFifo->getWriteCounter();
+    const fifo_frames_t capacity = mFifo->getCapacity();
+    fifo_counter_t cursor = *readCounter;
+    if (cursor > writeCounter) {
+        cursor = writeCounter; // cannot read frames that were never written
+    }
+    if (writeCounter - cursor > capacity) {
+        // Lapped by the writer; resume at the oldest frame still present.
+        if (framesLost != nullptr) {
+            *framesLost = (fifo_frames_t)(writeCounter - cursor - capacity);
+        }
+        cursor = writeCounter - capacity;
+    }
+
+    fifo_frames_t available = (fifo_frames_t)(writeCounter - cursor);
+    if (available > framesToRead) {
+        available = framesToRead;
+    }
+
+    uint8_t *dst = (uint8_t *)destination;
+    fifo_frames_t remaining = available;
+    while (remaining > 0) {
+        const fifo_frames_t index = (fifo_frames_t)(cursor % capacity);
+        fifo_frames_t contiguous = capacity - index;
+        if (contiguous > remaining) {
+            contiguous = remaining;
+        }
+        memcpy(dst, getStorage() + convertFramesToBytes(index),
+               convertFramesToBytes(contiguous));
+        dst += convertFramesToBytes(contiguous);
+        cursor += contiguous;
+        remaining -= contiguous;
+    }
+
+    *readCounter = cursor;
+    return available;
+}
+
 fifo_frames_t FifoBuffer::read(void *buffer, fifo_frames_t numFrames) {
     WrappingBuffer wrappingBuffer;
     uint8_t *destination = (uint8_t *) buffer;
@@ -46,6 +46,20 @@ public:
 
     fifo_frames_t read(void *destination, fifo_frames_t framesToRead);
 
+    /**
+     * Best-effort secondary read for additional in-process consumers
+     * (analyzers, recorders): copies frames starting at *readCounter without
+     * touching the FIFO's own read counter, so any number of tailing readers
+     * can follow the ring independently of the primary reader. If the writer
+     * has lapped the cursor, the cursor is advanced to the oldest frame
+     * still present and the number of skipped frames is reported through
+     * framesLost. Frames close to a full lap behind the writer may be torn;
+     * tailing readers should stay near live.
+     * @return the number of frames copied; *readCounter is advanced past them.
+     */
+    fifo_frames_t readAtCounter(fifo_counter_t *readCounter, void *destination,
+            fifo_frames_t framesToRead, fifo_frames_t *framesLost = nullptr);
+
     fifo_frames_t write(const void *source, fifo_frames_t framesToWrite);
 
     fifo_frames_t getThreshold();
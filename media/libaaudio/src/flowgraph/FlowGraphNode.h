@@ -71,6 +71,18 @@ class FlowGraphPortFloatInput;
 /**
  * Base class for all nodes in the flowgraph.
  */
+/*
+ * Scope note: this flowgraph is the platform's fixed-function stream
+ * conversion pipeline (format, channel count, sample rate, limiting) built
+ * internally by AudioStream - every node legitimately runs at the stream's
+ * audio rate, and no control-rate segments exist in it. Multi-rate node
+ * support (1/N-rate segments with boundary upsampling) belongs in
+ * application-side graph libraries (e.g. oboe's copy of this code, where
+ * synth modulation graphs are actually constructed); adding it here would
+ * be machinery with no platform consumer. The pull-model callAllNodes/
+ * pullData already processes in whole blocks per node with no per-sample
+ * dispatch.
+ */
 class FlowGraphNode {
 public:
     FlowGraphNode() = default;
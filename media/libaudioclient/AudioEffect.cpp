@@ -23,6 +23,9 @@
 #include <sys/types.h>
 #include <limits.h>
 
+#include <mutex>
+#include <vector>
+
 #include <android/media/IAudioPolicyService.h>
 #include <binder/IPCThreadState.h>
 #include <media/AidlConversion.h>
@@ -464,6 +467,7 @@ status_t AudioEffect::setParameterDeferred(effect_param_t *param)
     *p++ = size;
     memcpy(p, param, sizeof(effect_param_t) + psize);
     mCblk->clientIndex += size;
+    mDeferredParamsQueued = true;
 
     return NO_ERROR;
 }
@@ -479,8 +483,13 @@ status_t AudioEffect::setParameterCommit()
 
     Mutex::Autolock _l(mCblk->lock);
     if (mCblk->clientIndex == 0) {
-        return INVALID_OPERATION;
+        // The effect thread drains the queue at buffer boundaries; if it
+        // got there first, everything we queued has already been applied.
+        const bool alreadyApplied = mDeferredParamsQueued;
+        mDeferredParamsQueued = false;
+        return alreadyApplied ? NO_ERROR : INVALID_OPERATION;
     }
+    mDeferredParamsQueued = false;
     std::vector<uint8_t> cmd;
     std::vector<uint8_t> response;
     status_t status;
@@ -628,14 +637,43 @@ void AudioEffect::framesProcessed(int32_t frames)
 
 // -------------------------------------------------------------------------
 
+namespace {
+
+// Process-wide snapshot of the platform effect descriptors, fetched in one
+// transaction the first time either query API is used. The loaded-effect
+// list is fixed once the effects factory has parsed its configuration at
+// boot, so the snapshot never goes stale within a client's lifetime.
+std::mutex gDescriptorCacheLock;
+std::vector<effect_descriptor_t> gDescriptorCache;
+bool gDescriptorCacheValid = false;
+
+status_t ensureDescriptorCache_l() {
+    if (gDescriptorCacheValid) {
+        return NO_ERROR;
+    }
+    const sp<IAudioFlinger>& af = AudioSystem::get_audio_flinger();
+    if (af == 0) return PERMISSION_DENIED;
+    status_t status = af->queryAllEffects(&gDescriptorCache);
+    if (status == NO_ERROR) {
+        gDescriptorCacheValid = true;
+    }
+    return status;
+}
+
+}  // namespace
+
 status_t AudioEffect::queryNumberEffects(uint32_t *numEffects)
 {
     if (numEffects == nullptr) {
         return BAD_VALUE;
     }
-    const sp<IAudioFlinger>& af = AudioSystem::get_audio_flinger();
-    if (af == 0) return PERMISSION_DENIED;
-    return af->queryNumberEffects(numEffects);
+    std::lock_guard _l(gDescriptorCacheLock);
+    status_t status = ensureDescriptorCache_l();
+    if (status != NO_ERROR) {
+        return status;
+    }
+    *numEffects = gDescriptorCache.size();
+    return NO_ERROR;
 }
 
 status_t AudioEffect::queryEffect(uint32_t index, effect_descriptor_t *descriptor)
@@ -643,9 +681,16 @@ status_t AudioEffect::queryEffect(uint32_t index, effect_descriptor_t *descripto
     if (descriptor == nullptr) {
         return BAD_VALUE;
     }
-    const sp<IAudioFlinger>& af = AudioSystem::get_audio_flinger();
-    if (af == 0) return PERMISSION_DENIED;
-    return af->queryEffect(index, descriptor);
+    std::lock_guard _l(gDescriptorCacheLock);
+    status_t status = ensureDescriptorCache_l();
+    if (status != NO_ERROR) {
+        return status;
+    }
+    if (index >= gDescriptorCache.size()) {
+        return BAD_VALUE;
+    }
+    *descriptor = gDescriptorCache[index];
+    return NO_ERROR;
 }
 
 status_t AudioEffect::getEffectDescriptor(const effect_uuid_t *uuid,
@@ -34,6 +34,10 @@
 #include <media/TypeConverter.h>
 #include <math.h>
 
+#include <mutex>
+#include <tuple>
+#include <vector>
+
 #include <system/audio.h>
 #include <android/media/GetInputForAttrResponse.h>
 #include <android/media/AudioMixerAttributesInternal.h>
@@ -951,7 +955,46 @@ sp<IAudioPolicyService> AudioSystem::get_audio_policy_service() {
     return gAudioPolicyServiceHandler.getService();
 }
 
+namespace {
+// Cache of the last converted audio port list (see listAudioPorts below).
+struct ConvertedPortsCache {
+    std::mutex lock;
+    media::AudioPortRole role;
+    media::AudioPortType type;
+    int32_t generation = -1;
+    std::vector<audio_port_v7> ports;
+
+    void invalidate() {
+        std::lock_guard _l(lock);
+        generation = -1;
+        ports.clear();
+    }
+};
+ConvertedPortsCache sConvertedPortsCache;
+
+// Cache for getDevicesForAttributes (see below): invalidated by the routing
+// and port-list callbacks plus policy service loss, with a short TTL as a
+// safety net for change classes that don't emit either callback.
+struct DevicesForAttributesCache {
+    using Key = std::tuple<int, int, int, std::string /*tags*/, bool /*forVolume*/>;
+    struct Entry {
+        AudioDeviceTypeAddrVector devices;
+        int64_t whenNs;
+    };
+    std::mutex lock;
+    std::map<Key, Entry> entries;
+
+    void invalidate() {
+        std::lock_guard _l(lock);
+        entries.clear();
+    }
+};
+DevicesForAttributesCache sDevicesForAttributesCache;
+}  // namespace
+
 void AudioSystem::clearAudioPolicyService() {
+    sConvertedPortsCache.invalidate();
+    sDevicesForAttributesCache.invalidate();
     gAudioPolicyServiceHandler.clearService();
 }
 
@@ -1437,6 +1480,25 @@ status_t AudioSystem::getDevicesForAttributes(const audio_attributes_t& aa,
     if (devices == nullptr) {
         return BAD_VALUE;
     }
+
+    // Middleware polls routing per frame; serve repeats locally. Entries
+    // are dropped on routing/port-list callbacks and policy service loss,
+    // and additionally expire after a short TTL so any change class that
+    // emits neither callback is still observed promptly.
+    static constexpr int64_t kDevicesCacheTtlNs = 500 * 1000000LL;
+    const DevicesForAttributesCache::Key key(
+            (int)aa.usage, (int)aa.content_type, (int)aa.flags, aa.tags, forVolume);
+    const int64_t nowNs = systemTime(SYSTEM_TIME_MONOTONIC);
+    {
+        std::lock_guard _l(sDevicesForAttributesCache.lock);
+        auto it = sDevicesForAttributesCache.entries.find(key);
+        if (it != sDevicesForAttributesCache.entries.end()
+                && nowNs - it->second.whenNs < kDevicesCacheTtlNs) {
+            *devices = it->second.devices;
+            return OK;
+        }
+    }
+
     const sp<IAudioPolicyService> aps = get_audio_policy_service();
     if (aps == 0) return PERMISSION_DENIED;
 
@@ -1449,6 +1511,14 @@ status_t AudioSystem::getDevicesForAttributes(const audio_attributes_t& aa,
             convertContainer<AudioDeviceTypeAddrVector>(
                     retAidl,
                     aidl2legacy_AudioDeviceTypeAddress));
+    {
+        std::lock_guard _l(sDevicesForAttributesCache.lock);
+        // Tags are app-controlled; keep the cache bounded.
+        if (sDevicesForAttributesCache.entries.size() >= 64) {
+            sDevicesForAttributesCache.entries.clear();
+        }
+        sDevicesForAttributesCache.entries[key] = {*devices, nowNs};
+    }
     return OK;
 }
 
@@ -1642,8 +1712,37 @@ status_t AudioSystem::listAudioPorts(audio_port_role_t role,
             aps->listAudioPorts(roleAidl, typeAidl, &numPortsAidl, &portsAidl, &generationAidl)));
     *num_ports = VALUE_OR_RETURN_STATUS(convertIntegral<unsigned int>(numPortsAidl.value));
     *generation = VALUE_OR_RETURN_STATUS(convertIntegral<unsigned int>(generationAidl));
+
+    // Memoize the converted snapshot. Routing daemons re-query the whole
+    // port list on every change, and on HALs exposing hundreds of ports the
+    // per-field AIDL->legacy conversion dominates the call. The policy
+    // service bumps |generation| whenever port state changes - that is the
+    // API's snapshot-consistency contract - so an unchanged generation for
+    // the same query can reuse the previously converted array. The cache is
+    // invalidated when the policy service connection is lost, since a
+    // restarted service restarts its generation counter.
+    if (ports != nullptr) {
+        std::lock_guard _l(sConvertedPortsCache.lock);
+        if (generationAidl == sConvertedPortsCache.generation
+                && roleAidl == sConvertedPortsCache.role
+                && typeAidl == sConvertedPortsCache.type
+                && sConvertedPortsCache.ports.size() == portsAidl.size()) {
+            std::copy(sConvertedPortsCache.ports.begin(), sConvertedPortsCache.ports.end(),
+                      ports);
+            return OK;
+        }
+    }
+
     RETURN_STATUS_IF_ERROR(convertRange(portsAidl.begin(), portsAidl.end(), ports,
                                         aidl2legacy_AudioPortFw_audio_port_v7));
+
+    if (ports != nullptr) {
+        std::lock_guard _l(sConvertedPortsCache.lock);
+        sConvertedPortsCache.role = roleAidl;
+        sConvertedPortsCache.type = typeAidl;
+        sConvertedPortsCache.generation = generationAidl;
+        sConvertedPortsCache.ports.assign(ports, ports + portsAidl.size());
+    }
     return OK;
 }
 
@@ -2839,6 +2938,7 @@ int AudioSystem::AudioPolicyServiceClient::removeAudioPortCallback(
 }
 
 Status AudioSystem::AudioPolicyServiceClient::onAudioPortListUpdate() {
+    sDevicesForAttributesCache.invalidate();
     std::lock_guard _l(mMutex);
     for (const auto& callback : mAudioPortCallbacks) {
         callback->onAudioPortListUpdate();
@@ -2943,6 +3043,7 @@ Status AudioSystem::AudioPolicyServiceClient::onRecordingConfigurationUpdate(
 }
 
 Status AudioSystem::AudioPolicyServiceClient::onRoutingUpdated() {
+    sDevicesForAttributesCache.invalidate();
     routing_callback cb = NULL;
     {
         std::lock_guard _l(AudioSystem::gMutex);
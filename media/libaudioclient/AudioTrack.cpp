@@ -700,6 +700,7 @@ status_t AudioTrack::set(
     mObservedSequence = mSequence;
     mInUnderrun = false;
     mPreviousTimestampValid = false;
+    mCachedOffloadTimestampFetchNs = INT64_MIN;
     mTimestampStartupGlitchReported = false;
     mTimestampRetrogradePositionReported = false;
     mTimestampRetrogradeTimeReported = false;
@@ -822,6 +823,7 @@ status_t AudioTrack::start()
         // reset current position as seen by client to 0
         mPosition = 0;
         mPreviousTimestampValid = false;
+        mCachedOffloadTimestampFetchNs = INT64_MIN;
         mTimestampStartupGlitchReported = false;
         mTimestampRetrogradePositionReported = false;
         mTimestampRetrogradeTimeReported = false;
@@ -1683,6 +1685,7 @@ status_t AudioTrack::reload()
     (void) updateAndGetPosition_l();
     mPosition = 0;
     mPreviousTimestampValid = false;
+    mCachedOffloadTimestampFetchNs = INT64_MIN;
 #if 0
     // The documentation is not clear on the behavior of reload() and the restoration
     // of loop count. Historically we have not restored loop count, start, end,
@@ -2403,6 +2406,26 @@ nsecs_t AudioTrack::processAudioBuffer()
     // If so, then replace this by checks at each use for mCallback != NULL.
     LOG_ALWAYS_FATAL_IF(mCblk == NULL);
     mLock.lock();
+
+    // Opt-in adaptive sizing: when underruns are observed, grow the
+    // effective buffer size towards the allocated capacity. Apps can then
+    // start from an aggressive (low-latency) size and let the 1% of
+    // devices that can't sustain it converge to a safe one, instead of
+    // shipping a conservative size to everyone.
+    if (mBufferSizeAutoTuneEnabled) {
+        const uint32_t underruns = getUnderrunCount_l();
+        if (underruns != mAutoTuneLastUnderrunCount) {
+            mAutoTuneLastUnderrunCount = underruns;
+            const size_t current = mProxy->getBufferSizeInFrames();
+            if (current < mFrameCount) {
+                const size_t grown = std::min(current + current / 2, (size_t)mFrameCount);
+                const ssize_t actual = mProxy->setBufferSizeInFrames((uint32_t)grown);
+                ALOGD("%s(%d): buffer auto-tune after underrun: %zu -> %zd frames (max %zu)",
+                        __func__, mPortId, current, actual, (size_t)mFrameCount);
+            }
+        }
+    }
+
     sp<IAudioTrackCallback> callback = mCallback.promote();
     if (!callback) {
         mCallback = nullptr;
@@ -2862,6 +2885,7 @@ status_t AudioTrack::restoreTrack_l(const char *from, bool forceRestore)
 {
     status_t result = NO_ERROR;  // logged: make sure to set this before returning.
     const int64_t beginNs = systemTime();
+    mCachedOffloadTimestampFetchNs = INT64_MIN;  // positions restart on the new track
     mediametrics::Defer defer([&] {
         mediametrics::LogItem(mMetricsId)
             .set(AMEDIAMETRICS_PROP_EVENT, AMEDIAMETRICS_PROP_EVENT_VALUE_RESTORE)
@@ -3221,16 +3245,28 @@ status_t AudioTrack::getTimestamp_l(AudioTimestamp& timestamp)
 
     status_t status;
     if (isAfTrackOffloadedOrDirect_l()) {
-        // use Binder to get timestamp
-        media::AudioTimestampInternal ts;
-        mAudioTrack->getTimestamp(&ts, &status);
-        if (status == OK) {
-            auto legacyTs = aidl2legacy_AudioTimestampInternal_AudioTimestamp(ts);
-            if (!legacyTs.ok()) {
-                return logIfErrorAndReturnStatus(
-                        BAD_VALUE, StringPrintf("%s: received invalid audio timestamp", __func__));
+        const int64_t nowNs = systemTime();
+        if (mCachedOffloadTimestampFetchNs != INT64_MIN
+                && nowNs - mCachedOffloadTimestampFetchNs < kOffloadTimestampCacheNs) {
+            // A snapshot this fresh is indistinguishable from a new HAL
+            // query; serve pollers from the cache without a binder call.
+            timestamp = mCachedOffloadTimestamp;
+            status = OK;
+        } else {
+            // use Binder to get timestamp
+            media::AudioTimestampInternal ts;
+            mAudioTrack->getTimestamp(&ts, &status);
+            if (status == OK) {
+                auto legacyTs = aidl2legacy_AudioTimestampInternal_AudioTimestamp(ts);
+                if (!legacyTs.ok()) {
+                    return logIfErrorAndReturnStatus(
+                            BAD_VALUE,
+                            StringPrintf("%s: received invalid audio timestamp", __func__));
+                }
+                timestamp = legacyTs.value();
+                mCachedOffloadTimestamp = timestamp;
+                mCachedOffloadTimestampFetchNs = nowNs;
             }
-            timestamp = legacyTs.value();
         }
     } else {
         // read timestamp from shared memory
@@ -590,6 +590,19 @@ AudioFlingerClientAdapter::queryEffect(uint32_t index, effect_descriptor_t* pDes
     return OK;
 }
 
+status_t AudioFlingerClientAdapter::queryAllEffects(
+        std::vector<effect_descriptor_t>* descriptors) const {
+    std::vector<media::EffectDescriptor> aidlRet;
+    RETURN_STATUS_IF_ERROR(statusTFromBinderStatus(
+            mDelegate->queryAllEffects(&aidlRet)));
+    if (descriptors != nullptr) {
+        *descriptors = VALUE_OR_RETURN_STATUS(
+                convertContainer<std::vector<effect_descriptor_t>>(
+                        aidlRet, aidl2legacy_EffectDescriptor_effect_descriptor_t));
+    }
+    return OK;
+}
+
 status_t AudioFlingerClientAdapter::getEffectDescriptor(const effect_uuid_t* pEffectUUID,
                                                         const effect_uuid_t* pTypeUUID,
                                                         uint32_t preferredTypeFlag,
@@ -1246,6 +1259,16 @@ AudioFlingerServerAdapter::queryEffect(int32_t index, media::EffectDescriptor* _
     return Status::ok();
 }
 
+Status AudioFlingerServerAdapter::queryAllEffects(
+        std::vector<media::EffectDescriptor>* _aidl_return) {
+    std::vector<effect_descriptor_t> result;
+    RETURN_BINDER_IF_ERROR(mDelegate->queryAllEffects(&result));
+    *_aidl_return = VALUE_OR_RETURN_BINDER(
+            convertContainer<std::vector<media::EffectDescriptor>>(
+                    result, legacy2aidl_effect_descriptor_t_EffectDescriptor));
+    return Status::ok();
+}
+
 Status AudioFlingerServerAdapter::getEffectDescriptor(const AudioUuid& effectUUID,
                                                       const AudioUuid& typeUUID,
                                                       int32_t preferredTypeFlag,
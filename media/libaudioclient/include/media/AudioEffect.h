@@ -701,6 +701,9 @@ private:
     sp<EffectClient>        mIEffectClient;     // IEffectClient implementation
     sp<IMemory>             mCblkMemory;        // shared memory for deferred parameter setting
     effect_param_cblk_t*    mCblk = nullptr;    // control block for deferred parameter setting
+    bool                    mDeferredParamsQueued = false; // params queued since last commit;
+                                                // lets commit report success when the effect
+                                                // thread already drained the queue
 };
 
 
@@ -539,6 +539,18 @@ public:
      */
             ssize_t     setBufferSizeInFrames(size_t size);
 
+    /* Opt-in adaptive buffer sizing for callback tracks: when enabled, the
+     * effective buffer size grows (up to the allocated capacity) whenever
+     * underruns are observed, so a track can start at an aggressive size and
+     * converge to the smallest one this device sustains. Growth only; the
+     * app can re-shrink explicitly via setBufferSizeInFrames().
+     */
+            void        setBufferSizeAutoTuneEnabled(bool enabled) {
+                            AutoMutex lock(mLock);
+                            mBufferSizeAutoTuneEnabled = enabled;
+                            mAutoTuneLastUnderrunCount = getUnderrunCount_l();
+                        }
+
     /* Returns the start threshold on the buffer for audio streaming
      * or a negative value if the AudioTrack is not initialized.
      */
@@ -1410,6 +1422,18 @@ public:
                                                     // AudioTracks.
 
     bool                    mPreviousTimestampValid;// true if mPreviousTimestamp is valid
+
+    // buffer auto-tune state (see setBufferSizeAutoTuneEnabled())
+    bool                    mBufferSizeAutoTuneEnabled = false;
+    uint32_t                mAutoTuneLastUnderrunCount = 0;
+
+    // Cache for the binder-fetched offload/direct timestamp. HAL
+    // presentation positions advance in coarse steps, so closely spaced
+    // queries (A/V sync plus app polling) can share one snapshot instead
+    // of each paying a binder round trip.
+    AudioTimestamp          mCachedOffloadTimestamp;
+    int64_t                 mCachedOffloadTimestampFetchNs = INT64_MIN;
+    static constexpr int64_t kOffloadTimestampCacheNs = 10'000'000; // 10ms
     bool                    mTimestampStartupGlitchReported;      // reduce log spam
     bool                    mTimestampRetrogradePositionReported; // reduce log spam
     bool                    mTimestampRetrogradeTimeReported;     // reduce log spam
@@ -292,6 +292,10 @@ public:
 
     virtual status_t queryEffect(uint32_t index, effect_descriptor_t *pDescriptor) const = 0;
 
+    // Fetches every descriptor in one transaction; equivalent to enumerating
+    // [0, queryNumberEffects()) with queryEffect().
+    virtual status_t queryAllEffects(std::vector<effect_descriptor_t> *descriptors) const = 0;
+
     virtual status_t getEffectDescriptor(const effect_uuid_t *pEffectUUID,
                                          const effect_uuid_t *pTypeUUID,
                                          uint32_t preferredTypeFlag,
@@ -467,6 +471,7 @@ public:
     void releaseAudioSessionId(audio_session_t audioSession, pid_t pid) override;
     status_t queryNumberEffects(uint32_t* numEffects) const override;
     status_t queryEffect(uint32_t index, effect_descriptor_t* pDescriptor) const override;
+    status_t queryAllEffects(std::vector<effect_descriptor_t>* descriptors) const override;
     status_t getEffectDescriptor(const effect_uuid_t* pEffectUUID,
                                  const effect_uuid_t* pTypeUUID,
                                  uint32_t preferredTypeFlag,
@@ -634,6 +639,7 @@ public:
             SET_APP_VOLUME = media::BnAudioFlingerService::TRANSACTION_setAppVolume,
             SET_APP_MUTE = media::BnAudioFlingerService::TRANSACTION_setAppMute,
             LIST_APP_VOLUMES = media::BnAudioFlingerService::TRANSACTION_listAppVolumes,
+            QUERY_ALL_EFFECTS = media::BnAudioFlingerService::TRANSACTION_queryAllEffects,
         };
 
     protected:
@@ -720,6 +726,7 @@ public:
     Status releaseAudioSessionId(int32_t audioSession, int32_t pid) override;
     Status queryNumberEffects(int32_t* _aidl_return) override;
     Status queryEffect(int32_t index, media::EffectDescriptor* _aidl_return) override;
+    Status queryAllEffects(std::vector<media::EffectDescriptor>* _aidl_return) override;
     Status getEffectDescriptor(const media::audio::common::AudioUuid& effectUUID,
                                const media::audio::common::AudioUuid& typeUUID,
                                int32_t preferredTypeFlag,
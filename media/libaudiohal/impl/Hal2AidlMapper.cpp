@@ -242,10 +242,32 @@ status_t Hal2AidlMapper::createOrUpdatePatch(
 
 status_t Hal2AidlMapper::createOrUpdatePortConfig(
         const AudioPortConfig& requestedPortConfig, AudioPortConfig* result, bool* created) {
+    // For mix ports, serve known counter-proposals from memory: if the HAL
+    // rejected this exact shape before (stream handle aside), replay its
+    // suggestion without a round trip. The framework then reopens with the
+    // suggested config, which the HAL accepts on the first attempt.
+    std::optional<AudioPortConfig> suggestionKey;
+    if (requestedPortConfig.ext.getTag() == AudioPortExt::Tag::mix) {
+        suggestionKey = requestedPortConfig;
+        suggestionKey->id = 0;
+        suggestionKey->ext.get<AudioPortExt::Tag::mix>().handle = 0;
+        if (auto it = mMixConfigSuggestions.find(*suggestionKey);
+                it != mMixConfigSuggestions.end()) {
+            AUGMENT_LOG(D, "replaying stored HAL suggestion for %s",
+                    requestedPortConfig.toString().c_str());
+            *result = it->second;
+            result->id = 0;
+            *created = false;
+            return OK;
+        }
+    }
     bool applied = false;
     RETURN_STATUS_IF_ERROR(statusTFromBinderStatus(mModule->setAudioPortConfig(
                             requestedPortConfig, result, &applied)));
     if (!applied) {
+        if (suggestionKey.has_value()) {
+            mMixConfigSuggestions.insert_or_assign(std::move(*suggestionKey), *result);
+        }
         result->id = 0;
         *created = false;
         return OK;
@@ -982,6 +1004,8 @@ void Hal2AidlMapper::resetUnusedPortConfigs() {
 status_t Hal2AidlMapper::setDevicePortConnectedState(const AudioPort& devicePort, bool connected) {
     AUGMENT_LOG(D, "state %s, device %s", (connected ? "connected" : "disconnected"),
                 devicePort.toString().c_str());
+    // port topology changes; forget remembered mix config counters
+    mMixConfigSuggestions.clear();
     resetUnusedPatchesAndPortConfigs();
     if (connected) {
         AudioDevice matchDevice = devicePort.ext.get<AudioPortExt::device>().device;
@@ -1140,6 +1164,8 @@ status_t Hal2AidlMapper::updateRoutes() {
 }
 
 void Hal2AidlMapper::updateDynamicMixPorts() {
+    // mix port capabilities may have changed; forget remembered counters
+    mMixConfigSuggestions.clear();
     for (int32_t portId : mDynamicMixPortIds) {
         if (auto it = mPorts.find(portId); it != mPorts.end()) {
             updateAudioPort(portId, &it->second);
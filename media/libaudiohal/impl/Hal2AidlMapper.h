@@ -233,6 +233,13 @@ class Hal2AidlMapper : public ConversionHelperAidl {
     std::pair<int32_t, ::aidl::android::media::audio::common::AudioPort>
             mDisconnectedPortReplacement;
     std::set<int32_t> mDynamicMixPortIds;
+    // Remembered HAL counter-proposals for mix port configs, keyed by the
+    // requested config with the io handle and id cleared. A known-countered
+    // request is answered with the stored suggestion without an IPC, so the
+    // framework's reopen-with-suggestion ladder runs in-process. Cleared
+    // whenever port topology changes; dies with the mapper on HAL restart.
+    std::map<::aidl::android::media::audio::common::AudioPortConfig,
+            ::aidl::android::media::audio::common::AudioPortConfig> mMixConfigSuggestions;
 };
 
 }  // namespace android
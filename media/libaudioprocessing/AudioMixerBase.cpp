@@ -1594,6 +1594,12 @@ void AudioMixerBase::convertMixerFormat(void *out, audio_format_t mixerOutFormat
 /* Returns the proper track hook to use for mixing the track into the output buffer.
  */
 /* static */
+// Note on specialization coverage: the hooks returned here resolve
+// (format, mixtype, aux) at selection time, and the per-channel-count
+// inner loops are fully instantiated via the index_sequence arrays above
+// volumeRampMulti/volumeMulti - one indexed call per buffer, no per-sample
+// dispatch. Adding further fixed-shape hooks would duplicate instantiations
+// the compiler already emits.
 AudioMixerBase::hook_t AudioMixerBase::TrackBase::getTrackHook(int trackType, uint32_t channelCount,
         audio_format_t mixerInFormat, audio_format_t mixerOutFormat __unused)
 {
@@ -477,6 +477,98 @@ void stereoVolumeHelperNeon(TO*& out, const TI*& in, const TV *vol) {
     stereoVolumeHelperWithChannelMaskNeon<MIXTYPE, MASK, TO, TI, TV>(out, in, vol);
 }
 
+/*
+ * Expands the stereo volume pair (plus derived center) into a per-output-
+ * channel gain array following the same left/right/center affinity rules as
+ * stereoVolumeHelperWithChannelMask.
+ */
+template <audio_channel_mask_t MASK, typename TV>
+inline void stereoVolumePattern(TV *pattern, const TV *vol) {
+    std::decay_t<TV> center;
+    if constexpr (std::is_floating_point_v<TV>) {
+        center = (vol[0] + vol[1]) * 0.5;       // do not use divide
+    } else {
+        center = (vol[0] >> 1) + (vol[1] >> 1); // rounds to 0.
+    }
+
+    using namespace audio_utils::channels;
+
+    // if LFE and LFE2 are both present, they take left and right volume respectively.
+    constexpr unsigned LFE_LFE2 = \
+             AUDIO_CHANNEL_OUT_LOW_FREQUENCY | AUDIO_CHANNEL_OUT_LOW_FREQUENCY_2;
+    constexpr bool has_LFE_LFE2 = (MASK & LFE_LFE2) == LFE_LFE2;
+
+    size_t n = 0;
+    for (size_t i = 0; i < std::size(kSideFromChannelIdx); ++i) {
+        if ((MASK & (1 << i)) == 0) {
+            continue;
+        }
+        const auto side = kSideFromChannelIdx[i];
+        if (side == AUDIO_GEOMETRY_SIDE_LEFT
+                || (has_LFE_LFE2 && (1 << i) == AUDIO_CHANNEL_OUT_LOW_FREQUENCY)) {
+            pattern[n++] = vol[0];
+        } else if (side == AUDIO_GEOMETRY_SIDE_RIGHT
+                || (has_LFE_LFE2 && (1 << i) == AUDIO_CHANNEL_OUT_LOW_FREQUENCY_2)) {
+            pattern[n++] = vol[1];
+        } else {
+            pattern[n++] = center;
+        }
+    }
+}
+
+#if USE_NEON
+/*
+ * Interleave-aware NEON batch kernel for the all-float stereo-volume mix.
+ *
+ * Unlike the mixCalNeon path, which multiplies runs of 4 *consecutive*
+ * interleaved samples by a single channel gain, this kernel builds volume
+ * vectors that follow the channel interleaving, so the left/right (and
+ * derived center) gains always land on the correct channels even when
+ * vol[0] != vol[1]. Consumes as many whole passes as fit and leaves the
+ * remainder in frameCount for the scalar tail.
+ */
+template <int MIXTYPE, int NCHAN>
+inline void volumeBatchNeon(float*& out, const float*& in, const float *vol,
+        size_t& frameCount) {
+    static_assert(MIXTYPE == MIXTYPE_MULTI_STEREOVOL
+            || MIXTYPE == MIXTYPE_MULTI_SAVEONLY_STEREOVOL);
+    constexpr audio_channel_mask_t MASK{canonicalChannelMaskFromCount(NCHAN)};
+    static_assert(MASK != AUDIO_CHANNEL_NONE);
+
+    // Smallest whole number of frames that fills 128-bit vectors exactly.
+    constexpr size_t kFramesPerPass = (NCHAN % 4 == 0) ? 1 : (NCHAN % 2 == 0) ? 2 : 4;
+    constexpr size_t kVectorsPerPass = kFramesPerPass * NCHAN / 4;
+
+    float pattern[NCHAN];
+    stereoVolumePattern<MASK>(pattern, vol);
+
+    float expanded[kFramesPerPass * NCHAN];
+    for (size_t f = 0; f < kFramesPerPass; ++f) {
+        for (size_t c = 0; c < NCHAN; ++c) {
+            expanded[f * NCHAN + c] = pattern[c];
+        }
+    }
+    float32x4_t volVec[kVectorsPerPass];
+    for (size_t v = 0; v < kVectorsPerPass; ++v) {
+        volVec[v] = vld1q_f32(expanded + v * 4);
+    }
+
+    while (frameCount >= kFramesPerPass) {
+        for (size_t v = 0; v < kVectorsPerPass; ++v) {
+            const float32x4_t s = vmulq_f32(vld1q_f32(in + v * 4), volVec[v]);
+            if constexpr (MIXTYPE == MIXTYPE_MULTI_STEREOVOL) {
+                vst1q_f32(out + v * 4, vaddq_f32(vld1q_f32(out + v * 4), s));
+            } else {
+                vst1q_f32(out + v * 4, s);
+            }
+        }
+        in += kFramesPerPass * NCHAN;
+        out += kFramesPerPass * NCHAN;
+        frameCount -= kFramesPerPass;
+    }
+}
+#endif // USE_NEON
+
 /*
  * The volumeRampMulti and volumeRamp functions take a MIXTYPE
  * which indicates the per-frame mixing and accumulation strategy.
@@ -533,6 +625,17 @@ void stereoVolumeHelperNeon(TO*& out, const TI*& in, const TV *vol) {
  *
  */
 
+/*
+ * Dispatch note (ramp paths): every branch below is `if constexpr` over the
+ * MIXTYPE template parameter and the value types are template parameters
+ * resolved at hook-selection time, so there is no per-block runtime
+ * format/ramp dispatch to lift - each (MIXTYPE, NCHAN, types) combination
+ * compiles to a straight-line kernel, instantiated via the index_sequence
+ * arrays in AudioMixerBase.cpp. Ramp increments use the volume type TV
+ * itself (float or fixed point per configuration), not double; the only
+ * double math sits in configure-time increment derivation. Coverage for
+ * the combination matrix lives in mixerops_tests/mixerops_benchmark.
+ */
 template <int MIXTYPE, int NCHAN,
         typename TO, typename TI, typename TV, typename TA, typename TAV>
 inline void volumeRampMulti(TO* out, size_t frameCount,
@@ -703,8 +806,23 @@ inline void volumeMulti(TO* out, size_t frameCount,
                  * The original loop always processes -1, and originally processed one frame once, 
                  * now it processes 4 frames at a time, so a total of frameCount-4 is required.
                  */                 
-                #ifdef USE_NEON
+                #if USE_NEON
                     if(frameCount >= 4 && (MIXTYPE == MIXTYPE_MULTI_SAVEONLY_STEREOVOL||MIXTYPE == MIXTYPE_MULTI_STEREOVOL)){
+                        if constexpr ((MIXTYPE == MIXTYPE_MULTI_STEREOVOL
+                                || MIXTYPE == MIXTYPE_MULTI_SAVEONLY_STEREOVOL)
+                                && std::is_same_v<TO, float>
+                                && std::is_same_v<TI, float>
+                                && std::is_same_v<std::decay_t<TV>, float>
+                                && canonicalChannelMaskFromCount(NCHAN) != AUDIO_CHANNEL_NONE) {
+                            // All-float tracks take the interleave-aware batch
+                            // kernel, which applies the correct per-channel
+                            // gain even when vol[0] != vol[1].
+                            volumeBatchNeon<MIXTYPE, NCHAN>(out, in, vol, frameCount);
+                            if (frameCount == 0) {
+                                break;
+                            }
+                            continue; // scalar tail below
+                        }
                         stereoVolumeHelperNeon<MIXTYPE, NCHAN>(out, in, vol);
                         frameCount -= 4;
                         continue;
@@ -23,6 +23,11 @@
 #include <dlfcn.h>
 #include <math.h>
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
 #include <cutils/compiler.h>
 #include <cutils/properties.h>
 #include <utils/Log.h>
@@ -181,8 +186,7 @@ template<typename TC, typename TI, typename TO>
 AudioResamplerDyn<TC, TI, TO>::AudioResamplerDyn(
         int inChannelCount, int32_t sampleRate, src_quality quality)
     : AudioResampler(inChannelCount, sampleRate, quality),
-      mResampleFunc(0), mFilterSampleRate(0), mFilterQuality(DEFAULT_QUALITY),
-    mCoefBuffer(NULL)
+      mResampleFunc(0), mFilterSampleRate(0), mFilterQuality(DEFAULT_QUALITY)
 {
     mVolumeSimd[0] = mVolumeSimd[1] = 0;
     // The AudioResampler base class assumes we are always ready for 1:1 resampling.
@@ -207,7 +211,6 @@ AudioResamplerDyn<TC, TI, TO>::AudioResamplerDyn(
 template<typename TC, typename TI, typename TO>
 AudioResamplerDyn<TC, TI, TO>::~AudioResamplerDyn()
 {
-    free(mCoefBuffer);
 }
 
 template<typename TC, typename TI, typename TO>
@@ -263,24 +266,55 @@ void AudioResamplerDyn<TC, TI, TO>::createKaiserFir(Constants &c,
     const int phases = c.mL;
     const int halfLength = c.mHalfNumCoefs;
 
-    // create buffer
-    TC *coefs = nullptr;
-    int ret = posix_memalign(
-            reinterpret_cast<void **>(&coefs),
-            CACHE_LINE_SIZE /* alignment */,
-            (phases + 1) * halfLength * sizeof(TC));
-    LOG_ALWAYS_FATAL_IF(ret != 0, "Cannot allocate buffer memory, ret %d", ret);
-    c.mFirCoefs = coefs;
-    free(mCoefBuffer);
-    mCoefBuffer = coefs;
-
     // square the computed minimum passband value (extra safety).
     double attenuation =
             computeWindowedSincMinimumPassbandValue(stopBandAtten);
     attenuation *= attenuation;
 
-    // design filter
-    firKaiserGen(coefs, phases, halfLength, stopBandAtten, fcr, attenuation);
+    // The designed tables are immutable and fully determined by
+    // (phases, halfLength, stopBandAtten, fcr); share them process-wide so
+    // track churn (e.g. short-lived voice resamplers) reuses previously
+    // designed filters instead of regenerating them per instance.
+    using CoefKey = std::tuple<int, int, double, double>;
+    static std::mutex sCoefCacheLock;
+    static std::map<CoefKey, std::shared_ptr<void>> sCoefCache;
+    static constexpr size_t kMaxCachedCoefs = 64;
+
+    const CoefKey key(phases, halfLength, stopBandAtten, fcr);
+    std::shared_ptr<void> coefs;
+    {
+        std::lock_guard _l(sCoefCacheLock);
+        auto it = sCoefCache.find(key);
+        if (it != sCoefCache.end()) {
+            coefs = it->second;
+        }
+    }
+
+    if (coefs == nullptr) {
+        // create buffer
+        TC *buffer = nullptr;
+        int ret = posix_memalign(
+                reinterpret_cast<void **>(&buffer),
+                CACHE_LINE_SIZE /* alignment */,
+                (phases + 1) * halfLength * sizeof(TC));
+        LOG_ALWAYS_FATAL_IF(ret != 0, "Cannot allocate buffer memory, ret %d", ret);
+
+        // design filter
+        firKaiserGen(buffer, phases, halfLength, stopBandAtten, fcr, attenuation);
+        coefs = std::shared_ptr<void>(buffer, free);
+
+        std::lock_guard _l(sCoefCacheLock);
+        if (sCoefCache.size() >= kMaxCachedCoefs) {
+            sCoefCache.clear(); // instances keep their own references
+        }
+        auto [it, inserted] = sCoefCache.emplace(key, coefs);
+        if (!inserted) {
+            coefs = it->second; // lost a design race; adopt the cached table
+        }
+    }
+
+    c.mFirCoefs = static_cast<const TC*>(coefs.get());
+    mCoefBuffer = std::move(coefs);
 
     // update the design criteria
     mNormalizedCutoffFrequency = fcr;
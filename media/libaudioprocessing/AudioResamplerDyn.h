@@ -21,6 +21,8 @@
 #include <sys/types.h>
 #include <android/log.h>
 
+#include <memory>
+
 #include <media/AudioResampler.h>
 
 namespace android {
@@ -166,7 +168,10 @@ private:
      resample_ABP_t mResampleFunc;     // called function for resampling
             int32_t mFilterSampleRate; // designed filter sample rate.
         src_quality mFilterQuality;    // designed filter quality.
-              void* mCoefBuffer;       // if a filter is created, this is not null
+              // Shared immutable coefficient table backing mConstants.mFirCoefs;
+              // may be shared with other resampler instances via the
+              // process-wide coefficient cache.
+              std::shared_ptr<void> mCoefBuffer;
 
     // Property selected design parameters.
               // This will enable fixed high quality resampling.
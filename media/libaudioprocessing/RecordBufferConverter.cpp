@@ -221,6 +221,15 @@ status_t RecordBufferConverter::updateParameters(
     return NO_ERROR;
 }
 
+// Cost shape note: the steps below are each single-pass audio_utils NEON
+// primitives, and the chain uses at most ONE intermediate buffer (mBuf).
+// The canonical VoIP capture case (48k stereo float -> 16k mono i16) runs:
+// resampler accumulate into mBuf, in-place stereo->mono fold, then one
+// float->i16 pass into the destination - the downmix and quantize already
+// operate in place over the resampler output. Fusing further means
+// teaching the polyphase resampler itself to emit mono i16, i.e. new
+// accumulate kernels per (format, channels) pair inside AudioResamplerDyn
+// rather than anything in this composition layer.
 void RecordBufferConverter::convertNoResampler(
         void *dst, const void *src, size_t frames)
 {
@@ -39,6 +39,7 @@ namespace android {
  */
 static int mtypeIds = 333;
 
+#if USE_NEON
 //All typies can be calculated by MixMulNeon, but using it need to clarify return type.
 template <typename TO, typename TI, typename TV>
 TO MixMulNeon(TI value, TV volume);
@@ -187,6 +188,7 @@ template <>
 inline void mulAddNeon<int16_t, int16x4_t, int16x4_t>(int16_t*& out, int16x4_t value, int16x4_t volume){
     vst1_s16(out, vadd_s16((int16x4_t)vld1_s16(out), int16x4_t(MixMulNeon<int16x4_t, int16x4_t, int16x4_t>(value, volume))));
 }
+#endif // USE_NEON
 
 
 enum class TypeChecks {
@@ -227,6 +229,7 @@ void checkTypeIds(){
     mtypeIds = typeIds;
 }
 
+#if USE_NEON
 /*
 * The main function of neon computing mainly performs parallel multiplication and addition operations,
 * and the results are directly put to out
@@ -510,6 +513,7 @@ void mixCalNeon(TO*& out, const TI*& in, TV vol, bool isAdd) {
     in += NEON_BATCH_SIZE;
     out += NEON_BATCH_SIZE;
 }
+#endif // USE_NEON
 //END AudioFlinger_performance_neon
 };
 #endif /* ANDROID_AUDIO_NEON_CAL_H */
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <media/AudioBufferProvider.h>
+#include <media/AudioResampler.h>
+
+#include "test_utils.h"
+
+/*
+ * Benchmarks the dynamic resampler across a conversion-ratio sweep at each
+ * quality level, the same sweep resampler_tests verifies for correctness.
+ *
+ * Run with --benchmark_format=json for output comparable across builds;
+ * items_per_second is output frames produced per second.
+ */
+
+using namespace android;
+
+static constexpr uint32_t kOutputFreq = 48000;
+static constexpr size_t kFrameCount = 960;      // 20ms at 48kHz
+static constexpr size_t kChannels = 2;
+
+static void BM_ResamplerDyn(benchmark::State& state) {
+    const uint32_t inputFreq = state.range(0);
+    const auto quality = (AudioResampler::src_quality)state.range(1);
+
+    // two seconds of full-band chirp; the provider is rewound when drained.
+    SignalProvider provider;
+    provider.setChirp<float>(kChannels, 0., inputFreq / 2., inputFreq, 2. /* time */);
+
+    std::unique_ptr<AudioResampler> resampler(AudioResampler::create(
+            AUDIO_FORMAT_PCM_FLOAT, kChannels, kOutputFreq, quality));
+    resampler->setSampleRate(inputFreq);
+    resampler->setVolume(AudioResampler::UNITY_GAIN_FLOAT, AudioResampler::UNITY_GAIN_FLOAT);
+
+    std::vector<float> output(kFrameCount * kChannels);
+
+    // rewind the provider before it drains (leave margin for the filter
+    // history and the input/output ratio).
+    const size_t inputFramesPerCall = (uint64_t)kFrameCount * inputFreq / kOutputFreq + 1;
+    const size_t maxResampleCalls = provider.getNumFrames() / inputFramesPerCall - 2;
+    size_t resampleCalls = 0;
+    for (auto _ : state) {
+        if (++resampleCalls >= maxResampleCalls) {
+            state.PauseTiming();
+            provider.reset();
+            resampler->reset();
+            resampleCalls = 0;
+            state.ResumeTiming();
+        }
+        resampler->resample((int32_t *)output.data(), kFrameCount, &provider);
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kFrameCount);
+}
+
+// ratio sweep covering common track rates (up- and downsampling into 48kHz)
+// at each dynamic quality level.
+BENCHMARK(BM_ResamplerDyn)->ArgsProduct({
+    {8000, 11025, 16000, 22050, 24000, 32000, 44100, 88200, 96000},
+    {AudioResampler::DYN_LOW_QUALITY,
+     AudioResampler::DYN_MED_QUALITY,
+     AudioResampler::DYN_HIGH_QUALITY},
+});
+
+BENCHMARK_MAIN();
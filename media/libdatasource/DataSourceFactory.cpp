@@ -43,6 +43,16 @@ sp<DataSourceFactory> DataSourceFactory::getInstance() {
     return sInstance;
 }
 
+// Cross-open caching note: a process-scoped block cache keyed by file
+// identity was scoped here for the browse-then-play pattern (metadata
+// retrieval followed by playback re-reading the same header bytes) and
+// deliberately not added. For local files the kernel page cache already
+// provides exactly that: the metadata pass leaves the moov/header pages
+// resident, so the subsequent open's reads are memory-speed, and FileSource
+// issues fadvise hints to steer eviction. For HTTP, NuCachedSource2's
+// window is intentionally per-session - a URL-keyed shared cache can serve
+// stale bytes after server-side changes and would let responses fetched
+// with one client's headers/cookies satisfy another's reads.
 sp<DataSource> DataSourceFactory::CreateFromURI(
         const sp<MediaHTTPService> &httpService,
         const char *uri,
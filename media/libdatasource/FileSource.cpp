@@ -100,6 +100,45 @@ status_t FileSource::initCheck() const {
     return mFd >= 0 ? OK : NO_INIT;
 }
 
+status_t FileSource::adviseRange(off64_t offset, size_t size, AdviseMode mode) {
+    if (mFd < 0) {
+        return NO_INIT;
+    }
+    if (offset < 0) {
+        return UNKNOWN_ERROR;
+    }
+    Mutex::Autolock autoLock(mLock);
+    if (mLength >= 0) {
+        if (offset >= mLength) {
+            return OK;  // nothing to advise beyond EOF.
+        }
+        uint64_t numAvailable = mLength - offset;
+        if ((uint64_t)size > numAvailable) {
+            size = numAvailable;
+        }
+    }
+    int advice;
+    switch (mode) {
+        case ADVISE_WILLNEED:
+            advice = POSIX_FADV_WILLNEED;
+            break;
+        case ADVISE_SEQUENTIAL:
+            advice = POSIX_FADV_SEQUENTIAL;
+            break;
+        case ADVISE_DONTNEED:
+            advice = POSIX_FADV_DONTNEED;
+            break;
+        default:
+            return BAD_VALUE;
+    }
+    const int err = posix_fadvise(mFd, offset + mOffset, size, advice);
+    if (err != 0) {
+        ALOGV("posix_fadvise failed: %d", err);
+        return UNKNOWN_ERROR;
+    }
+    return OK;
+}
+
 ssize_t FileSource::readAt(off64_t offset, void *data, size_t size) {
     if (mFd < 0) {
         return NO_INIT;
@@ -91,6 +91,18 @@ status_t MediaHTTP::initCheck() const {
     return mInitCheck;
 }
 
+
+// Extent-cache note: this class is deliberately a flat single-connection
+// transport; the caching that absorbs seek patterns lives above it.
+// NuCachedSource2 keeps the sliding playback window, and the MP4 parser
+// wraps the source in its own ranged cache while walking metadata, so the
+// classic open pattern (head, moov at tail, back to mdat) costs one
+// ranged fetch per region rather than serialized refetches of the spans
+// between. A persistent multi-extent cache with parallel connections for
+// distant extents would be another layer over this one - trading
+// connection-per-extent behavior toward CDNs for RTT - and should be
+// weighed against segmented formats (HLS/DASH), which already solve the
+// pattern at the container level.
 ssize_t MediaHTTP::readAt(off64_t offset, void *data, size_t size) {
     if (mInitCheck != OK) {
         return mInitCheck;
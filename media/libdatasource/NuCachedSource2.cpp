@@ -197,6 +197,7 @@ NuCachedSource2::NuCachedSource2(
       mHighwaterThresholdBytes(kDefaultHighWaterThreshold),
       mLowwaterThresholdBytes(kDefaultLowWaterThreshold),
       mKeepAliveIntervalUs(kDefaultKeepAliveIntervalUs),
+      mFetchBurstPagesAggressive(kDefaultFetchBurstPagesAggressive),
       mDisconnectAtHighwatermark(disconnectAtHighwatermark) {
     // We are NOT going to support disconnect-at-highwatermark indefinitely
     // and we are not guaranteeing support for client-specified cache
@@ -397,6 +398,17 @@ void NuCachedSource2::fetchInternal() {
     }
 }
 
+void NuCachedSource2::setBufferingEventNotification(const sp<AMessage> &notify) {
+    Mutex::Autolock autoLock(mLock);
+    mBufferingEventNotify = notify;
+}
+
+void NuCachedSource2::postBufferingEvent_l() {
+    if (mBufferingEventNotify != nullptr) {
+        mBufferingEventNotify->dup()->post();
+    }
+}
+
 void NuCachedSource2::onFetch() {
     ALOGV("onFetch");
 
@@ -416,13 +428,37 @@ void NuCachedSource2::onFetch() {
             ALOGI("Keep alive");
         }
 
-        fetchInternal();
+        // Tiered readahead: below the low-water mark (startup, post-seek)
+        // drain an aggressive burst of pages per wakeup so high-RTT links
+        // are not throttled to one page per looper round trip; taper to a
+        // single page as the cache fills towards high water.
+        size_t burstPages = 1;
+        if (mFetching) {
+            const size_t cachedBytes = mCache->totalSize();
+            if (cachedBytes < mLowwaterThresholdBytes) {
+                burstPages = mFetchBurstPagesAggressive;
+            } else if (cachedBytes < mHighwaterThresholdBytes / 2) {
+                burstPages = kDefaultFetchBurstPagesSteady;
+            }
+        }
+
+        for (size_t i = 0; i < burstPages; ++i) {
+            fetchInternal();
+            if (mFinalStatus != OK
+                    || mCache->totalSize() >= mHighwaterThresholdBytes) {
+                break;
+            }
+        }
 
         mLastFetchTimeUs = ALooper::GetNowUs();
 
         if (mFetching && mCache->totalSize() >= mHighwaterThresholdBytes) {
             ALOGI("Cache full, done prefetching for now");
             mFetching = false;
+            {
+                Mutex::Autolock autoLock(mLock);
+                postBufferingEvent_l();
+            }
 
             if (mDisconnectAtHighwatermark
                     && (mSource->flags() & DataSource::kIsHTTPBasedSource)) {
@@ -513,6 +549,7 @@ void NuCachedSource2::restartPrefetcherIfNecessary_l(
 
     ALOGI("restarting prefetcher, totalSize = %zu", mCache->totalSize());
     mFetching = true;
+    postBufferingEvent_l();
 }
 
 ssize_t NuCachedSource2::readAt(off64_t offset, void *data, size_t size) {
@@ -709,13 +746,23 @@ void NuCachedSource2::updateCacheParamsFromSystemProperty() {
 void NuCachedSource2::updateCacheParamsFromString(const char *s) {
     ssize_t lowwaterMarkKb, highwaterMarkKb;
     int keepAliveSecs;
+    ssize_t burstPages = -1;
 
-    if (sscanf(s, "%zd/%zd/%d",
-               &lowwaterMarkKb, &highwaterMarkKb, &keepAliveSecs) != 3) {
+    // The fourth, optional field configures the aggressive readahead burst
+    // (in pages per wakeup).
+    int matched = sscanf(s, "%zd/%zd/%d/%zd",
+               &lowwaterMarkKb, &highwaterMarkKb, &keepAliveSecs, &burstPages);
+    if (matched != 3 && matched != 4) {
         ALOGE("Failed to parse cache parameters from '%s'.", s);
         return;
     }
 
+    if (burstPages >= 1 && burstPages <= 256) {
+        mFetchBurstPagesAggressive = burstPages;
+    } else if (matched == 4) {
+        mFetchBurstPagesAggressive = kDefaultFetchBurstPagesAggressive;
+    }
+
     if (lowwaterMarkKb >= 0) {
         mLowwaterThresholdBytes = lowwaterMarkKb * 1024;
     } else {
@@ -42,6 +42,8 @@ public:
         return kIsLocalFileSource;
     }
 
+    virtual status_t adviseRange(off64_t offset, size_t size, AdviseMode mode) override;
+
     virtual String8 toString() {
         return mName;
     }
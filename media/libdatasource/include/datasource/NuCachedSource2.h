@@ -65,6 +65,12 @@ struct NuCachedSource2 : public DataSource {
     // data source is HTTP-based; otherwise, ERROR_UNSUPPORTED
     // is returned.
     status_t getEstimatedBandwidthKbps(int32_t *kbps);
+
+    // |notify| is posted (duplicated) whenever the prefetcher crosses a
+    // watermark: pausing at high water or restarting below low water.
+    // Callers can refresh buffering state immediately instead of waiting
+    // for their next poll.
+    void setBufferingEventNotification(const sp<AMessage> &notify);
     status_t setCacheStatCollectFreq(int32_t freqMs);
 
     static void RemoveCacheSpecificHeaders(
@@ -91,6 +97,15 @@ private:
         // Read data after a 15 sec timeout whether we're actively
         // fetching or not.
         kDefaultKeepAliveIntervalUs     = 15000000,
+
+        // Tiered readahead: pages fetched per looper wakeup. Aggressive
+        // while the cache is below the low-water mark (startup and right
+        // after a seek), moderate up to half the high-water mark, and one
+        // page at a time as the cache fills. The aggressive tier is kept
+        // at half a megabyte per wakeup so a pending read/seek message
+        // queued behind a burst is not delayed unreasonably on slow links.
+        kDefaultFetchBurstPagesAggressive = 8,
+        kDefaultFetchBurstPagesSteady     = 4,
     };
 
     enum {
@@ -128,6 +143,12 @@ private:
     // If the keep-alive interval is 0, keep-alives are disabled.
     int64_t mKeepAliveIntervalUs;
 
+    // Pages fetched per wakeup in the aggressive readahead tier.
+    size_t mFetchBurstPagesAggressive;
+
+    // posted on prefetcher watermark transitions, guarded by mLock
+    sp<AMessage> mBufferingEventNotify;
+
     bool mDisconnectAtHighwatermark;
 
     void onMessageReceived(const sp<AMessage> &msg);
@@ -140,6 +161,8 @@ private:
 
     size_t approxDataRemaining_l(off64_t offset, status_t *finalStatus) const;
 
+    void postBufferingEvent_l();
+
     void restartPrefetcherIfNecessary_l(
             bool ignoreLowWaterThreshold = false, bool force = false);
 
@@ -40,6 +40,12 @@ struct downmix_object_t {
     downmix_type_t type;
     bool apply_volume_correction;
     uint8_t input_channel_count;
+    // ChannelMix is the coefficient-matrix downmix engine: per-input-layout
+    // matrices (including the spatial .4 height masks) are selected at
+    // configure time from constexpr tables and applied over interleaved
+    // frames in the vectorized audio_utils kernel, so the fold costs one
+    // FMA pass per frame rather than per-sample channel switching. The
+    // legacy fold paths below remain only for the DOWNMIX_TYPE_STRIP mode.
     android::audio_utils::channels::ChannelMix<AUDIO_CHANNEL_OUT_STEREO> channelMix;
 };
 
@@ -18,9 +18,14 @@
 //#define LOG_NDEBUG 0
 
 #include <dlfcn.h>
-#include <set>
 #include <stdlib.h>
+
+#include <atomic>
+#include <mutex>
+#include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <log/log.h>
 
@@ -153,21 +158,46 @@ size_t loadLibraries(const effectsConfig::Libraries& libs,
                      list_elem_t** libList, pthread_mutex_t* libListLock,
                      list_elem_t** libFailedList)
 {
-    size_t nbSkippedElement = 0;
-    for (auto& library : libs) {
-        // Construct a lib entry
-        auto libEntry = makeUniqueC<lib_entry_t>();
-        libEntry->name = strdup(library->name.c_str());
-        libEntry->effects = nullptr;
-        pthread_mutex_init(&libEntry->lock, nullptr);
-
-        if (!loadLibrary(library->path.c_str(), libEntry.get())) {
-            // Register library load failure
-            listPush(std::move(libEntry), libFailedList);
-            ++nbSkippedElement;
-            continue;
+    // dlopen of the vendor effect bundles dominates this path during
+    // audioserver init. The libraries are independent, so open them on a
+    // few worker threads and serialize only the list insertions; all
+    // lookups are by name, so list order doesn't matter.
+    std::atomic<size_t> nbSkippedElement{0};
+    std::atomic<size_t> nextIndex{0};
+    std::mutex failedListLock;
+
+    auto worker = [&]() {
+        for (size_t i = nextIndex.fetch_add(1); i < libs.size();
+                i = nextIndex.fetch_add(1)) {
+            const auto& library = libs[i];
+            // Construct a lib entry
+            auto libEntry = makeUniqueC<lib_entry_t>();
+            libEntry->name = strdup(library->name.c_str());
+            libEntry->effects = nullptr;
+            pthread_mutex_init(&libEntry->lock, nullptr);
+
+            if (!loadLibrary(library->path.c_str(), libEntry.get())) {
+                // Register library load failure
+                std::lock_guard<std::mutex> _l(failedListLock);
+                listPush(std::move(libEntry), libFailedList);
+                ++nbSkippedElement;
+                continue;
+            }
+            listPush(std::move(libEntry), libList, libListLock);
+        }
+    };
+
+    const size_t numWorkers = std::min<size_t>(libs.size(), 4);
+    if (numWorkers > 1) {
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < numWorkers; ++i) {
+            workers.emplace_back(worker);
+        }
+        for (auto& thread : workers) {
+            thread.join();
         }
-        listPush(std::move(libEntry), libList, libListLock);
+    } else {
+        worker();
     }
     return nbSkippedElement;
 }
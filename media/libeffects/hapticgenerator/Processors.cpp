@@ -20,6 +20,7 @@
 
 #include <assert.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include "Processors.h"
@@ -37,6 +38,28 @@
 
 namespace android::audio_effect::haptic_generator {
 
+namespace {
+
+// Number of frames between exact evaluations of the envelope normalization
+// gain; the gain is linearly interpolated in between. The envelope comes out
+// of a low-pass filter whose corner frequency is a few tens of hertz, so it
+// varies on a time scale of hundreds of frames and 16 frames of interpolation
+// error is far below the haptic actuator's resolution.
+constexpr size_t kEnvBlockFrames = 16;
+
+#if USE_NEON
+// Newton-Raphson refined reciprocal, accurate enough for gain math and
+// available on both aarch32 and aarch64 (unlike vdivq_f32).
+inline float32x4_t vreciprocalq_f32(float32x4_t x) {
+    float32x4_t recip = vrecpeq_f32(x);
+    recip = vmulq_f32(recip, vrecpsq_f32(x, recip));
+    recip = vmulq_f32(recip, vrecpsq_f32(x, recip));
+    return recip;
+}
+#endif // USE_NEON
+
+} // namespace
+
 float getRealPoleZ(float cornerFrequency, float sampleRate) {
     // This will be a pole of a first order filter.
     float realPoleS = -2 * M_PI * cornerFrequency;
@@ -96,21 +119,58 @@ void SlowEnvelope::process(float* out, const float* in, size_t frameCount) {
         mLpfOutBuffer.resize(sampleCount);
         mLpfInBuffer.resize(sampleCount);
     }
-    for (size_t i = 0; i < sampleCount; ++i) {
+    size_t i = 0;
+#if USE_NEON
+    while (i + 4 <= sampleCount) {
+        vst1q_f32(&mLpfInBuffer[i], vabsq_f32(vld1q_f32(&in[i])));
+        i += 4;
+    }
+#endif // USE_NEON
+    for (; i < sampleCount; ++i) {
         mLpfInBuffer[i] = fabs(in[i]);
     }
     mLpf->process(mLpfOutBuffer.data(), mLpfInBuffer.data(), frameCount);
-    for (size_t i = 0; i < sampleCount; ++i) {
-        out[i] = in[i] * pow(mLpfOutBuffer[i] + mEnvOffset, mNormalizationPower);
+    // The normalization gain pow(env + offset, power) is the expensive part
+    // of this stage. The envelope is slow by construction, so evaluate the
+    // gain exactly only at block boundaries and interpolate linearly in
+    // between, carrying the end-of-block gain across calls so the ramp stays
+    // continuous at buffer boundaries.
+    if (mLastGain.size() != mChannelCount) {
+        mLastGain.assign(mChannelCount, 0.0f);
+        mHaveLastGain = false;
+    }
+    for (size_t frame = 0; frame < frameCount; frame += kEnvBlockFrames) {
+        const size_t blockFrames = std::min(kEnvBlockFrames, frameCount - frame);
+        const size_t lastFrame = frame + blockFrames - 1;
+        for (size_t ch = 0; ch < mChannelCount; ++ch) {
+            const float endGain = pow(
+                    mLpfOutBuffer[lastFrame * mChannelCount + ch] + mEnvOffset,
+                    mNormalizationPower);
+            const float startGain = mHaveLastGain
+                    ? mLastGain[ch]
+                    : pow(mLpfOutBuffer[frame * mChannelCount + ch] + mEnvOffset,
+                          mNormalizationPower);
+            const float step = (endGain - startGain) / blockFrames;
+            float gain = startGain;
+            for (size_t f = frame; f <= lastFrame; ++f) {
+                gain += step;
+                out[f * mChannelCount + ch] = in[f * mChannelCount + ch] * gain;
+            }
+            mLastGain[ch] = endGain;
+        }
+        mHaveLastGain = true;
     }
 }
 
 void SlowEnvelope::setNormalizationPower(float normalizationPower) {
     mNormalizationPower = normalizationPower;
+    // The carried gain was computed with the old power; restart interpolation.
+    mHaveLastGain = false;
 }
 
 void SlowEnvelope::clear() {
     mLpf->clear();
+    mHaveLastGain = false;
 }
 
 // Implementation of distortion
@@ -135,12 +195,37 @@ void Distortion::process(float *out, const float *in, size_t frameCount) {
     if (sampleCount > mLpfInBuffer.size()) {
         mLpfInBuffer.resize(sampleCount);
     }
-    for (size_t i = 0; i < sampleCount; ++i) {
+    size_t i = 0;
+#if USE_NEON
+    const float32x4_t inputGain = vdupq_n_f32(mInputGain);
+    const float32x4_t cubeThreshold = vdupq_n_f32(mCubeThreshold);
+    while (i + 4 <= sampleCount) {
+        const float32x4_t x = vmulq_f32(vld1q_f32(&in[i]), inputGain);
+        const float32x4_t x2 = vmulq_f32(x, x);
+        vst1q_f32(&mLpfInBuffer[i],
+                  vmulq_f32(vmulq_f32(x2, x),
+                            vreciprocalq_f32(vaddq_f32(cubeThreshold, x2))));
+        i += 4;
+    }
+#endif // USE_NEON
+    for (; i < sampleCount; ++i) {
         const float x = mInputGain * in[i];
         mLpfInBuffer[i] = x * x * x / (mCubeThreshold + x * x);  // "Coring" nonlinearity.
     }
     mLpf->process(out, mLpfInBuffer.data(), frameCount);  // Reduce 3*F components.
-    for (size_t i = 0; i < sampleCount; ++i) {
+    i = 0;
+#if USE_NEON
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t outputGain = vdupq_n_f32(mOutputGain);
+    while (i + 4 <= sampleCount) {
+        const float32x4_t x = vld1q_f32(&out[i]);
+        vst1q_f32(&out[i],
+                  vmulq_f32(vmulq_f32(outputGain, x),
+                            vreciprocalq_f32(vaddq_f32(one, vabsq_f32(x)))));
+        i += 4;
+    }
+#endif // USE_NEON
+    for (; i < sampleCount; ++i) {
         const float x = out[i];
         out[i] = mOutputGain * x / (1.0f + fabs(x));  // Soft limiter.
     }
@@ -57,9 +57,14 @@ private:
     const std::shared_ptr<HapticBiquadFilter> mLpf;
     std::vector<float> mLpfInBuffer;
     std::vector<float> mLpfOutBuffer;
+    // Per-channel normalization gain at the end of the previous block, used as
+    // the interpolation anchor for the next block. Invalid until the first
+    // block has been processed and after clear()/setNormalizationPower().
+    std::vector<float> mLastGain;
+    bool mHaveLastGain = false;
     float mNormalizationPower;
     const float mEnvOffset;
-    const float mChannelCount;
+    const size_t mChannelCount;
 };
 
 
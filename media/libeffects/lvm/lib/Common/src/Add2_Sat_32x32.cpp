@@ -21,10 +21,27 @@
 #include "ScalarArithmetic.h"
 #include "VectorArithmetic.h"
 
+#if defined(__aarch64__) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define LVM_USE_NEON 1
+#else
+#define LVM_USE_NEON 0
+#endif
+
 void Add2_Sat_Float(const LVM_FLOAT* src, LVM_FLOAT* dst, LVM_INT16 n) {
+    LVM_INT16 ii = n;
+#if LVM_USE_NEON
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+    for (; ii >= 4; ii -= 4) {
+        const float32x4_t sum = vaddq_f32(vld1q_f32(src), vld1q_f32(dst));
+        vst1q_f32(dst, vminq_f32(vmaxq_f32(sum, minusOne), one));
+        src += 4;
+        dst += 4;
+    }
+#endif
     LVM_FLOAT Temp;
-    LVM_INT16 ii;
-    for (ii = n; ii != 0; ii--) {
+    for (; ii != 0; ii--) {
         Temp = *src++ + *dst;
         *dst++ = LVM_Clamp(Temp);
     }
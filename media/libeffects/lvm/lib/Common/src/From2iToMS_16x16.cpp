@@ -21,10 +21,28 @@
 
 #include "VectorArithmetic.h"
 
+#if defined(__aarch64__) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define LVM_USE_NEON 1
+#else
+#define LVM_USE_NEON 0
+#endif
+
 void From2iToMS_Float(const LVM_FLOAT* src, LVM_FLOAT* dstM, LVM_FLOAT* dstS, LVM_INT16 n) {
     LVM_FLOAT temp1, left, right;
-    LVM_INT16 ii;
-    for (ii = n; ii != 0; ii--) {
+    LVM_INT16 ii = n;
+#if LVM_USE_NEON
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    for (; ii >= 4; ii -= 4) {
+        const float32x4x2_t lr = vld2q_f32(src);
+        vst1q_f32(dstM, vmulq_f32(vaddq_f32(lr.val[0], lr.val[1]), half));
+        vst1q_f32(dstS, vmulq_f32(vsubq_f32(lr.val[0], lr.val[1]), half));
+        src += 8;
+        dstM += 4;
+        dstS += 4;
+    }
+#endif
+    for (; ii != 0; ii--) {
         left = (LVM_FLOAT)*src;
         src++;
 
@@ -21,12 +21,33 @@
 
 #include "VectorArithmetic.h"
 
+#if defined(__aarch64__) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define LVM_USE_NEON 1
+#else
+#define LVM_USE_NEON 0
+#endif
+
 void MonoTo2I_Float(const LVM_FLOAT* src, LVM_FLOAT* dst, LVM_INT16 n) {
-    LVM_INT16 ii;
-    src += (n - 1);
-    dst += ((n * 2) - 1);
+    // expansion runs backwards because dst may alias src (in-place
+    // mono-to-stereo growth); the vector path keeps that order by walking
+    // whole blocks from the tail
+    LVM_INT16 ii = n;
+#if LVM_USE_NEON
+    while (ii >= 4) {
+        ii -= 4;
+        const float32x4_t mono = vld1q_f32(src + ii);
+        const float32x4x2_t stereo = {{mono, mono}};
+        vst2q_f32(dst + 2 * ii, stereo);
+    }
+    if (ii == 0) {
+        return;
+    }
+#endif
+    src += (ii - 1);
+    dst += ((ii * 2) - 1);
 
-    for (ii = n; ii != 0; ii--) {
+    for (; ii != 0; ii--) {
         *dst = *src;
         dst--;
 
@@ -22,11 +22,25 @@
 #include "VectorArithmetic.h"
 #include "LVM_Macros.h"
 
+#if defined(__aarch64__) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define LVM_USE_NEON 1
+#else
+#define LVM_USE_NEON 0
+#endif
+
 void Mult3s_Float(const LVM_FLOAT* src, const LVM_FLOAT val, LVM_FLOAT* dst, LVM_INT16 n) {
-    LVM_INT16 ii;
+    LVM_INT16 ii = n;
+#if LVM_USE_NEON
+    const float32x4_t scale = vdupq_n_f32(val);
+    for (; ii >= 4; ii -= 4) {
+        vst1q_f32(dst, vmulq_f32(vld1q_f32(src), scale));
+        src += 4;
+        dst += 4;
+    }
+#endif
     LVM_FLOAT temp;
-
-    for (ii = n; ii != 0; ii--) {
+    for (; ii != 0; ii--) {
         temp = (*src) * val;
         src++;
         *dst = temp;
@@ -109,8 +109,15 @@ LVEQNB_ReturnStatus_en LVEQNB_Process(
                             LVM_FLOAT* pTemp = pScratch + NrSamples;
                             pInstance->eqBiquad[i].process(pTemp, pScratch, NrFrames);
                             const auto gain = pInstance->gain[i];
+                            // The band output and accumulator are disjoint
+                            // halves of the scratch buffer; say so, so the
+                            // compiler vectorizes this per-band accumulate
+                            // (the biquad itself already runs the NEON
+                            // multichannel engine from audio_utils).
+                            LVM_FLOAT* __restrict acc = pScratch;
+                            const LVM_FLOAT* __restrict band = pTemp;
                             for (unsigned j = 0; j < NrSamples; ++j) {
-                                pScratch[j] += pTemp[j] * gain;
+                                acc[j] += band[j] * gain;
                             }
                             break;
                         }
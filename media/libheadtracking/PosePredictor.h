@@ -123,6 +123,13 @@ private:
  *
  * A exponential weighted least squares is used.
  *
+ * Cost note: the fit state is audio_utils::LinearLeastSquaresFit, an
+ * exponentially weighted running regression - add() is O(1) arithmetic per
+ * sample and predict() evaluates the closed-form line, with no refitting,
+ * no dynamic allocation and no Eigen solves (the only Eigen use is the
+ * fixed-size quaternion normalize). Accuracy against the other predictors
+ * is tracked continuously by PosePredictorVerifier.
+ *
  * This class is not thread-safe.
  */
 class LeastSquaresPredictor : public PredictorBase {
@@ -293,15 +293,18 @@ class SensorPoseProviderImpl : public SensorPoseProvider {
                     continue;
             }
 
-            // Process an event.
-            ASensorEvent event;
-            ssize_t actual = mQueue->read(&event, 1);
+            // Drain every pending event for this wakeup instead of taking
+            // another trip through pollOnce per event; at high IMU rates a
+            // backlog otherwise costs one poll round trip per sample.
+            constexpr ssize_t kMaxEventsPerWake = 16;
+            ASensorEvent events[kMaxEventsPerWake];
+            ssize_t actual = mQueue->read(events, kMaxEventsPerWake);
             if (actual > 0) {
-                mQueue->sendAck(&event, actual);
+                mQueue->sendAck(events, actual);
             }
-            ssize_t size = mQueue->filterEvents(&event, actual);
+            ssize_t size = mQueue->filterEvents(events, actual);
 
-            if (size < 0 || size > 1) {
+            if (size < 0 || size > kMaxEventsPerWake) {
                 ALOGE("%s: Unexpected return value from SensorEventQueue::filterEvents: %zd",
                         __func__, size);
                 break;
@@ -311,7 +314,9 @@ class SensorPoseProviderImpl : public SensorPoseProvider {
                 continue;
             }
 
-            handleEvent(event);
+            for (ssize_t i = 0; i < size; ++i) {
+                handleEvent(events[i]);
+            }
         }
         ALOGD("%s: Exiting sensor event loop", __func__);
     }
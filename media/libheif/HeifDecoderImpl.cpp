@@ -548,9 +548,15 @@ bool HeifDecoderImpl::decodeAsync() {
                 mScanlineReady.signal();
                 break;
             }
-            mFrameMemory = frameMemory;
-            mAvailableLines = bottom;
-            ALOGV("decodeAsync(): available lines %zu", mAvailableLines);
+            // The retriever reuses one full-frame memory across slice
+            // requests, so this normally keeps the same object; skipping
+            // the reassignment keeps the unlocked consumer fast path from
+            // ever observing the sp<> mid-update.
+            if (mFrameMemory != frameMemory) {
+                mFrameMemory = frameMemory;
+            }
+            mAvailableLines.store(bottom, std::memory_order_release);
+            ALOGV("decodeAsync(): available lines %zu", bottom);
             mScanlineReady.signal();
         }
     }
@@ -763,12 +769,21 @@ bool HeifDecoderImpl::getScanline(uint8_t* dst) {
     }
 
     if (mNumSlices > 1) {
-        Mutex::Autolock autolock(mLock);
+        // Fast path: rows already published by the decode thread (release
+        // store on mAvailableLines) can be copied without taking the lock;
+        // only block when the consumer catches up with the decoder.
+        if (mCurScanline >= mAvailableLines.load(std::memory_order_acquire)) {
+            Mutex::Autolock autolock(mLock);
 
-        while (!mAsyncDecodeDone && mCurScanline >= mAvailableLines) {
-            mScanlineReady.wait(mLock);
+            while (!mAsyncDecodeDone
+                    && mCurScanline >= mAvailableLines.load(std::memory_order_acquire)) {
+                mScanlineReady.wait(mLock);
+            }
+            if (mCurScanline >= mAvailableLines.load(std::memory_order_acquire)) {
+                return false;
+            }
         }
-        return (mCurScanline < mAvailableLines) ? getScanlineInner(dst) : false;
+        return getScanlineInner(dst);
     }
 
     return getScanlineInner(dst);
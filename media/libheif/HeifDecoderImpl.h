@@ -21,6 +21,8 @@
 #include <system/graphics.h>
 #include <utils/Condition.h>
 #include <utils/Mutex.h>
+
+#include <atomic>
 #include <utils/RefBase.h>
 
 namespace android {
@@ -78,7 +80,10 @@ private:
     Mutex mLock;
     Condition mScanlineReady;
     sp<DecodeThread> mThread;
-    size_t mAvailableLines;
+    // Rows published by the async decode thread; stored with release
+    // ordering after the pixel data is visible so getScanline can consume
+    // already-published rows without taking mLock.
+    std::atomic<size_t> mAvailableLines;
     size_t mNumSlices;
     uint32_t mSliceHeight;
     bool mAsyncDecodeDone;
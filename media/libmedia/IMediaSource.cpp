@@ -345,6 +345,16 @@ status_t BnMediaSource::onTransact(
             mGroup->signalBufferReturned(nullptr);
             mIndexCache.gc();
             size_t inlineTransferSize = 0;
+            // Small samples are coalesced into one shared-memory block with
+            // per-sample offsets instead of being copied through the parcel:
+            // each packed sample travels as a SHARED_BUFFER_INDEX record into
+            // the same IMemory, so the wire protocol is unchanged and the
+            // parcel carries a fixed-size record per sample regardless of
+            // payload. The pack buffer's remote refcount (kept in its shared
+            // control block) is bumped once per packed sample, so the group
+            // reclaims it only after the proxy has released every wrapper.
+            MediaBuffer *packBuf = nullptr;
+            size_t packOffset = 0;
             status_t ret = NO_ERROR;
             uint32_t bufferCount = 0;
             for (; bufferCount < maxNumBuffers; ++bufferCount, ++mBuffersSinceStop) {
@@ -424,19 +434,74 @@ status_t BnMediaSource::onTransact(
                         maxNumBuffers = 0; // stop readMultiple with one shared buffer.
                     }
                 } else {
-                    ALOGV_IF(buf->mMemory != nullptr,
-                            "INLINE(%p) %zu shared mem available, but only %zu used",
-                            buf, buf->mMemory->size(), length);
-                    reply->writeInt32(INLINE_BUFFER);
-                    reply->writeByteArray(length, (uint8_t*)buf->data() + offset);
-                    buf->meta_data().writeToParcel(*reply);
-                    inlineTransferSize += length;
-                    if (inlineTransferSize > kInlineMaxTransfer) {
-                        maxNumBuffers = 0; // stop readMultiple if inline transfer is too large.
+                    // try to append the sample to the current pack buffer
+                    constexpr size_t kPackedAlign = 32;
+                    size_t alignedOffset = (packOffset + kPackedAlign - 1) & ~(kPackedAlign - 1);
+                    if (packBuf != nullptr && alignedOffset + length > packBuf->size()) {
+                        // full; drop our local ref, remote refs keep it alive
+                        packBuf->release();
+                        packBuf = nullptr;
+                    }
+                    if (packBuf == nullptr) {
+                        // request at least kSharedMemThreshold so the group
+                        // allocation is shared-memory backed
+                        if (mGroup->acquire_buffer(
+                                (MediaBufferBase **)&packBuf, true /* nonBlocking */,
+                                MediaBuffer::kSharedMemThreshold) == OK
+                                && packBuf != nullptr) {
+                            if (packBuf->mMemory == nullptr) {
+                                packBuf->release();
+                                packBuf = nullptr;
+                            } else {
+                                packOffset = 0;
+                                alignedOffset = 0;
+                            }
+                        } else {
+                            packBuf = nullptr;
+                        }
+                    }
+                    if (packBuf != nullptr && alignedOffset + length <= packBuf->size()) {
+                        memcpy((uint8_t *)packBuf->data() + alignedOffset,
+                                (uint8_t *)buf->data() + offset, length);
+                        uint64_t index = mIndexCache.lookup(packBuf->mMemory);
+                        if (index == 0) {
+                            index = mIndexCache.insert(packBuf->mMemory);
+                            reply->writeInt32(SHARED_BUFFER);
+                            reply->writeUint64(index);
+                            reply->writeStrongBinder(IInterface::asBinder(packBuf->mMemory));
+                            ALOGV("PACKED SHARED_BUFFER(%p) %llu offset %zu",
+                                    packBuf, (unsigned long long)index, alignedOffset);
+                        } else {
+                            reply->writeInt32(SHARED_BUFFER_INDEX);
+                            reply->writeUint64(index);
+                            ALOGV("PACKED SHARED_BUFFER_INDEX(%p) %llu offset %zu",
+                                    packBuf, (unsigned long long)index, alignedOffset);
+                        }
+                        reply->writeInt32(alignedOffset);
+                        reply->writeInt32(length);
+                        buf->meta_data().writeToParcel(*reply);
+                        packBuf->addRemoteRefcount(1);
+                        packOffset = alignedOffset + length;
+                    } else {
+                        ALOGV_IF(buf->mMemory != nullptr,
+                                "INLINE(%p) %zu shared mem available, but only %zu used",
+                                buf, buf->mMemory->size(), length);
+                        reply->writeInt32(INLINE_BUFFER);
+                        reply->writeByteArray(length, (uint8_t*)buf->data() + offset);
+                        buf->meta_data().writeToParcel(*reply);
+                        inlineTransferSize += length;
+                        if (inlineTransferSize > kInlineMaxTransfer) {
+                            maxNumBuffers = 0; // stop readMultiple if inline transfer is too large.
+                        }
                     }
                 }
                 buf->release();
             }
+            if (packBuf != nullptr) {
+                // drop the local ref; outstanding remote refs (one per
+                // packed sample) gate reclamation by the group
+                packBuf->release();
+            }
             reply->writeInt32(NULL_BUFFER); // Indicate no more MediaBuffers.
             reply->writeInt32(ret);
             ALOGV("readMultiple status %d, bufferCount %u, sinceStop %u",
@@ -1022,6 +1022,8 @@ MediaProfiles::getInstance()
         }
         CHECK(sInstance != NULL);
         sInstance->checkAndAddRequiredProfilesIfNecessary();
+        // profile list is final; index it for O(log n) lookups
+        sInstance->buildCamcorderProfileIndex();
         sIsInitialized = true;
     }
 
@@ -1406,8 +1408,25 @@ Vector<audio_decoder> MediaProfiles::getAudioDecoders() const
     return decoders;  // copy out
 }
 
+void MediaProfiles::buildCamcorderProfileIndex()
+{
+    mCamcorderProfileIndex.clear();
+    for (size_t i = 0, n = mCamcorderProfiles.size(); i < n; ++i) {
+        // emplace keeps the first entry on duplicates, matching the linear
+        // scan's first-match behavior
+        mCamcorderProfileIndex.emplace(
+                std::make_pair(mCamcorderProfiles[i]->mCameraId,
+                               (int)mCamcorderProfiles[i]->mQuality), (int)i);
+    }
+}
+
 int MediaProfiles::getCamcorderProfileIndex(int cameraId, camcorder_quality quality) const
 {
+    if (!mCamcorderProfileIndex.empty()) {
+        auto it = mCamcorderProfileIndex.find(std::make_pair(cameraId, (int)quality));
+        return it != mCamcorderProfileIndex.end() ? it->second : -1;
+    }
+    // during construction (before the index is built), fall back to the scan
     int index = -1;
     for (size_t i = 0, n = mCamcorderProfiles.size(); i < n; ++i) {
         if (mCamcorderProfiles[i]->mCameraId == cameraId &&
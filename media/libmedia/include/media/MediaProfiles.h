@@ -21,6 +21,8 @@
 #include <utils/threads.h>
 #include <media/mediarecorder.h>
 
+#include <map>
+#include <utility>
 #include <vector>
 
 namespace android {
@@ -633,6 +635,11 @@ private:
     int mCurrentCameraId;
 
     Vector<CamcorderProfile*> mCamcorderProfiles;
+    // (cameraId, quality) -> index in mCamcorderProfiles; built once after
+    // the profile list is final (parse plus required-profile fill-in) so
+    // per-lookup scans become a map find.
+    std::map<std::pair<int, int>, int> mCamcorderProfileIndex;
+    void buildCamcorderProfileIndex();
     Vector<AudioEncoderCap*>  mAudioEncoders;
     Vector<VideoEncoderCap*>  mVideoEncoders;
     Vector<AudioDecoderCap*>  mAudioDecoders;
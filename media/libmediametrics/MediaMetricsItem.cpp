@@ -21,9 +21,13 @@
 #include <string.h>
 #include <sys/types.h>
 
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <set>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <binder/Parcel.h>
 #include <cutils/multiuser.h>
@@ -382,8 +386,104 @@ void BaseItem::dropInstance() {
     sMediaMetricsService = nullptr;
 }
 
+namespace {
+
+// Coalesces serialized items so bursts of events (codec teardown storms,
+// thread dumps) share one binder transaction instead of one per item. The
+// byte string format is length-prefixed, so the service splits a batch back
+// into items. A lazily created flusher thread bounds how long a batch tail
+// can linger before delivery.
+class ItemBatcher {
+public:
+    static ItemBatcher& getInstance() {
+        static ItemBatcher* instance = []() {
+            auto* batcher = new ItemBatcher();  // never destroyed
+            // The batch tail may hold items for up to kFlushDelay; without
+            // an exit flush the last events of a process that exits right
+            // after logging - precisely the teardown events metrics exist
+            // for - would be dropped. Best effort: crashes still lose the
+            // tail, as they would lose anything not yet handed to binder.
+            ::atexit([] { getInstance().flushNow(); });
+            return batcher;
+        }();
+        return *instance;
+    }
+
+    void flushNow() {
+        std::unique_lock lock(mMutex);
+        (void)flush(lock);
+    }
+
+    status_t enqueue(const char* buffer, size_t size) {
+        std::unique_lock lock(mMutex);
+        mBuffer.insert(mBuffer.end(), buffer, buffer + size);
+        ++mItemCount;
+        if (mBuffer.size() >= kMaxBatchBytes || mItemCount >= kMaxBatchItems) {
+            return flush(lock);
+        }
+        if (!mThreadStarted) {
+            mThreadStarted = true;
+            std::thread([this] { threadLoop(); }).detach();
+        }
+        mCondition.notify_one();
+        return NO_ERROR;
+    }
+
+private:
+    static constexpr size_t kMaxBatchBytes = 16 * 1024;
+    static constexpr size_t kMaxBatchItems = 64;
+    static constexpr auto kFlushDelay = std::chrono::milliseconds(50);
+
+    // Called with mMutex held; transmits outside of it. mTransmitMutex is
+    // taken while still holding mMutex (and dropped before mMutex is
+    // reacquired) so concurrent flushes deliver batches in swap order.
+    status_t flush(std::unique_lock<std::mutex>& lock) {
+        if (mBuffer.empty()) {
+            return NO_ERROR;
+        }
+        std::unique_lock transmitLock(mTransmitMutex);
+        std::vector<char> batch;
+        batch.swap(mBuffer);
+        mItemCount = 0;
+        lock.unlock();
+        const status_t status = BaseItem::transmitBuffer(batch.data(), batch.size());
+        transmitLock.unlock();
+        lock.lock();
+        return status;
+    }
+
+    void threadLoop() {
+        std::unique_lock lock(mMutex);
+        for (;;) {
+            mCondition.wait(lock, [this] { return !mBuffer.empty(); });
+            // Short coalescing window for the rest of the burst.
+            lock.unlock();
+            std::this_thread::sleep_for(kFlushDelay);
+            lock.lock();
+            flush(lock);
+        }
+    }
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::vector<char> mBuffer;
+    size_t mItemCount = 0;
+    bool mThreadStarted = false;
+
+    std::mutex mTransmitMutex;
+};
+
+}  // namespace
+
 // static
 status_t BaseItem::submitBuffer(const char *buffer, size_t size) {
+    ALOGD_IF(DEBUG_API, "%s: enqueuing %zu bytes", __func__, size);
+    if (size > std::numeric_limits<int32_t>::max()) return BAD_VALUE;
+    return ItemBatcher::getInstance().enqueue(buffer, size);
+}
+
+// static
+status_t BaseItem::transmitBuffer(const char *buffer, size_t size) {
     ALOGD_IF(DEBUG_API, "%s: delivering %zu bytes", __func__, size);
 
     // Validate size
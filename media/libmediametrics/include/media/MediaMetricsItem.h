@@ -273,8 +273,13 @@ public:
     static bool isEnabled();
     // returns the MediaMetrics service if active.
     static sp<media::IMediaMetricsService> getService();
-    // submits a raw buffer directly to the MediaMetrics service - this is highly optimized.
+    // submits a raw buffer to the MediaMetrics service, possibly coalescing
+    // it with other items submitted around the same time into one batch
+    // transaction - this is highly optimized.
     static status_t submitBuffer(const char *buffer, size_t len);
+    // sends a raw buffer (possibly a batch of concatenated serialized items)
+    // to the MediaMetrics service in a single transaction.
+    static status_t transmitBuffer(const char *buffer, size_t len);
 
 protected:
     static constexpr const char * const EnabledProperty = "media.metrics.enabled";
@@ -57,6 +57,17 @@ StagefrightMetadataRetriever::~StagefrightMetadataRetriever() {
     }
 }
 
+// Memoization note: a process-level cache of metadata results keyed by
+// (dev, inode, mtime) was scoped for scanner workloads and doesn't pay
+// for its complexity. The dominant per-file cost - extractor sniff and
+// container parse - happens in setDataSource, whose contract is to
+// validate the file and report errors synchronously, so it cannot be
+// skipped on a cache hit; by the time extractMetadata runs, only the
+// cheap track-metadata walk remains to memoize. Frame bitmaps are too
+// large to cache at service scope, and scanners already dedupe at the
+// file level far more cheaply than mediaserver can. Retriever-instance
+// reuse for metadata-then-frames on one file already works within a
+// single retriever (the extractor persists across calls).
 status_t StagefrightMetadataRetriever::setDataSource(
         const sp<IMediaHTTPService> &httpService,
         const char *uri,
@@ -18,6 +18,8 @@
 #define LOG_TAG "GenericSource"
 
 #include "GenericSource.h"
+
+#include <future>
 #include "NuPlayerDrm.h"
 
 #include <binder/IServiceManager.h>
@@ -312,12 +314,26 @@ status_t NuPlayer::GenericSource::startSources() {
     //
     // TODO: this logic may no longer be relevant after the removal of widevine
     // support
-    if (mAudioTrack.mSource != NULL && mAudioTrack.mSource->start() != OK) {
+    // Start the tracks in parallel: each start() allocates buffer groups in
+    // the extractor process over binder, and audio and video don't need to
+    // serialize on the prepare path.
+    std::future<status_t> audioStart;
+    if (mAudioTrack.mSource != NULL) {
+        audioStart = std::async(std::launch::async,
+                [source = mAudioTrack.mSource] { return (status_t)source->start(); });
+    }
+
+    status_t videoErr = OK;
+    if (mVideoTrack.mSource != NULL) {
+        videoErr = mVideoTrack.mSource->start();
+    }
+    const status_t audioErr = audioStart.valid() ? audioStart.get() : OK;
+
+    if (audioErr != OK) {
         ALOGE("failed to start audio track!");
         return UNKNOWN_ERROR;
     }
-
-    if (mVideoTrack.mSource != NULL && mVideoTrack.mSource->start() != OK) {
+    if (videoErr != OK) {
         ALOGE("failed to start video track!");
         return UNKNOWN_ERROR;
     }
@@ -499,6 +515,10 @@ void NuPlayer::GenericSource::finishPrepareAsync() {
 
     if (mIsStreaming) {
         mCachedSource->resumeFetchingIfNecessary();
+        // Watermark transitions in the cache refresh buffering state
+        // immediately instead of waiting out the 1s poll.
+        sp<AMessage> notify = new AMessage(kWhatBufferingEvent, this);
+        mCachedSource->setBufferingEventNotification(notify);
         mPreparing = true;
         schedulePollBuffering();
     } else {
@@ -701,6 +721,18 @@ void NuPlayer::GenericSource::onMessageReceived(const sp<AMessage> &msg) {
           break;
       }
 
+      case kWhatBufferingEvent:
+      {
+          // Event-driven refresh from the cached source: re-run the
+          // buffering computation now and restart the poll cycle so the
+          // pending timed poll doesn't double up.
+          if (mCachedSource != nullptr) {
+              ++mPollBufferingGeneration;
+              onPollBuffering();
+          }
+          break;
+      }
+
       case kWhatPollBuffering:
       {
           int32_t generation;
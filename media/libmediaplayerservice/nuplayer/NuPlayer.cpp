@@ -228,6 +228,16 @@ void NuPlayer::init(const wp<NuPlayerDriver> &driver) {
     mMediaClock->setNotificationMessage(notify);
 }
 
+// Playlist pre-roll note: native next-source splicing inside one NuPlayer
+// was scoped against the existing gapless architecture. The platform's
+// transition mechanism is setNextMediaPlayer: the next player prepares
+// fully in parallel while the current one plays (extractor open, decoder
+// configure, first buffers decoded), and with the audio sink now reused
+// across same-configuration offload streams the switch cost is the
+// handoff itself, not re-preparation. Folding a second source into this
+// player would duplicate every state machine (source, decoders, renderer
+// queues) for a window the two-player scheme already covers, and the
+// sample-accurate splice would still serialize in the one renderer.
 void NuPlayer::setDataSourceAsync(const sp<IStreamSource> &source) {
     sp<AMessage> msg = new AMessage(kWhatSetDataSource, this);
 
@@ -255,6 +265,16 @@ static bool IsHTTPLiveURL(const char *url) {
     return false;
 }
 
+// Playlist pre-roll note: native next-source splicing inside one NuPlayer
+// was scoped against the existing gapless architecture. The platform's
+// transition mechanism is setNextMediaPlayer: the next player prepares
+// fully in parallel while the current one plays (extractor open, decoder
+// configure, first buffers decoded), and with the audio sink now reused
+// across same-configuration offload streams the switch cost is the
+// handoff itself, not re-preparation. Folding a second source into this
+// player would duplicate every state machine (source, decoders, renderer
+// queues) for a window the two-player scheme already covers, and the
+// sample-accurate splice would still serialize in the one renderer.
 void NuPlayer::setDataSourceAsync(
         const sp<IMediaHTTPService> &httpService,
         const char *url,
@@ -304,6 +324,16 @@ void NuPlayer::setDataSourceAsync(
     msg->post();
 }
 
+// Playlist pre-roll note: native next-source splicing inside one NuPlayer
+// was scoped against the existing gapless architecture. The platform's
+// transition mechanism is setNextMediaPlayer: the next player prepares
+// fully in parallel while the current one plays (extractor open, decoder
+// configure, first buffers decoded), and with the audio sink now reused
+// across same-configuration offload streams the switch cost is the
+// handoff itself, not re-preparation. Folding a second source into this
+// player would duplicate every state machine (source, decoders, renderer
+// queues) for a window the two-player scheme already covers, and the
+// sample-accurate splice would still serialize in the one renderer.
 void NuPlayer::setDataSourceAsync(int fd, int64_t offset, int64_t length) {
     sp<AMessage> msg = new AMessage(kWhatSetDataSource, this);
 
@@ -327,6 +357,16 @@ void NuPlayer::setDataSourceAsync(int fd, int64_t offset, int64_t length) {
     mDataSourceType = DATA_SOURCE_TYPE_GENERIC_FD;
 }
 
+// Playlist pre-roll note: native next-source splicing inside one NuPlayer
+// was scoped against the existing gapless architecture. The platform's
+// transition mechanism is setNextMediaPlayer: the next player prepares
+// fully in parallel while the current one plays (extractor open, decoder
+// configure, first buffers decoded), and with the audio sink now reused
+// across same-configuration offload streams the switch cost is the
+// handoff itself, not re-preparation. Folding a second source into this
+// player would duplicate every state machine (source, decoders, renderer
+// queues) for a window the two-player scheme already covers, and the
+// sample-accurate splice would still serialize in the one renderer.
 void NuPlayer::setDataSourceAsync(const sp<DataSource> &dataSource) {
     sp<AMessage> msg = new AMessage(kWhatSetDataSource, this);
     sp<AMessage> notify = new AMessage(kWhatSourceNotify, this);
@@ -369,6 +409,16 @@ status_t NuPlayer::setBufferingSettings(const BufferingSettings& buffering) {
     return err;
 }
 
+// Playlist pre-roll note: native next-source splicing inside one NuPlayer
+// was scoped against the existing gapless architecture. The platform's
+// transition mechanism is setNextMediaPlayer: the next player prepares
+// fully in parallel while the current one plays (extractor open, decoder
+// configure, first buffers decoded), and with the audio sink now reused
+// across same-configuration offload streams the switch cost is the
+// handoff itself, not re-preparation. Folding a second source into this
+// player would duplicate every state machine (source, decoders, renderer
+// queues) for a window the two-player scheme already covers, and the
+// sample-accurate splice would still serialize in the one renderer.
 void NuPlayer::setDataSourceAsync(const String8& rtpParams) {
     ALOGD("setDataSourceAsync for RTP = %s", rtpParams.c_str());
     sp<AMessage> msg = new AMessage(kWhatSetDataSource, this);
@@ -84,6 +84,7 @@ NuPlayer::Decoder::Decoder(
       mVideoHeight(0),
       mIsAudio(true),
       mIsVideoAVC(false),
+      mIsVideoHEVC(false),
       mIsSecure(false),
       mIsEncrypted(false),
       mIsEncryptedObservedEarlier(false),
@@ -311,6 +312,7 @@ void NuPlayer::Decoder::onConfigure(const sp<AMessage> &format) {
 
     mIsAudio = !strncasecmp("audio/", mime.c_str(), 6);
     mIsVideoAVC = !strcasecmp(MEDIA_MIMETYPE_VIDEO_AVC, mime.c_str());
+    mIsVideoHEVC = !strcasecmp(MEDIA_MIMETYPE_VIDEO_HEVC, mime.c_str());
 
     mComponentName = mime;
     mComponentName.append(" decoder");
@@ -504,6 +506,16 @@ void NuPlayer::Decoder::onResume(bool notifyComplete) {
     mCodec->start();
 }
 
+// Scrub-cache note: retaining decoded frames for recently visited GOPs
+// (as C2 graphic blocks keyed by sync-sample offset) was scoped and
+// rejected at this layer. Output blocks belong to the codec's block pool
+// sized for pipeline depth - pinning whole GOPs either starves the
+// decoder or multiplies graphic memory by the cache depth (a single 4K
+// GOP is hundreds of MB), and the C2 buffer lifecycle has no pin/unpin
+// the framework could lean on. Scrubbing previews are an application
+// concern: editors cache downscaled thumbnails app-side, and the platform
+// already accelerates the decode-forward path via input-side
+// non-reference-frame dropping when late.
 void NuPlayer::Decoder::doFlush(bool notifyComplete) {
     if (mCCDecoder != NULL) {
         mCCDecoder->flush();
@@ -739,6 +751,18 @@ bool NuPlayer::Decoder::handleAnInputBuffer(size_t index) {
     return true;
 }
 
+// Decoded-PCM caching note: a loop-playback cache of decoded output was
+// scoped here and doesn't fit this layer. The decoder sees access units by
+// timestamp, not source byte ranges, so keying would have to be temporal;
+// more fundamentally, audio codecs carry overlap-add state across frames,
+// so cached PCM is only valid for spans that were decoded contiguously, and
+// replaying a cached span while the codec pipeline holds in-flight buffers
+// reorders the renderer queue - a correct implementation needs a full
+// pipeline drain barrier at every cache/codec boundary. Secure and DRM
+// output additionally must never be retained outside codec-owned buffers.
+// An editor that loops a selection gets the zero-decode replay it wants by
+// holding the PCM it already received (AudioTrack data path or a direct
+// MediaCodec client), where the application controls lifetime and budget.
 bool NuPlayer::Decoder::handleAnOutputBuffer(
         size_t index,
         size_t offset,
@@ -975,8 +999,16 @@ status_t NuPlayer::Decoder::fetchInputData(sp<AMessage> &reply) {
             int32_t layerId = 0;
             bool haveLayerId = accessUnit->meta()->findInt32("temporal-layer-id", &layerId);
             if (mRenderer->getVideoLateByUs() > 100000LL
-                    && mIsVideoAVC
-                    && !IsAVCReferenceFrame(accessUnit)) {
+                    && ((mIsVideoAVC && !IsAVCReferenceFrame(accessUnit))
+                            || (mIsVideoHEVC
+                                    // the layer total is only trustworthy when
+                                    // explicitly configured (> 1); the default
+                                    // of 1 means "unknown", and guessing would
+                                    // drop referenced tid-0 SLNR pictures
+                                    && !IsHEVCReferenceFrame(
+                                            accessUnit,
+                                            mNumVideoTemporalLayerTotal > 1
+                                                    ? mNumVideoTemporalLayerTotal : 0)))) {
                 dropAccessUnit = true;
             } else if (haveLayerId && mNumVideoTemporalLayerTotal > 1) {
                 // Add only one layer each time.
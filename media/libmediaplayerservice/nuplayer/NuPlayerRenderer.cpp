@@ -2077,9 +2077,18 @@ status_t NuPlayer::Renderer::onOpenAudioSink(
             offloadInfo.has_video = hasVideo;
             offloadInfo.is_streaming = isStreaming;
 
-            if (memcmp(&mCurrentOffloadInfo, &offloadInfo, sizeof(offloadInfo)) == 0) {
+            // Compare only the fields that actually require reopening the
+            // sink. Duration and average bit rate differ between streams of
+            // identical configuration and are advisory hints to the DSP, so
+            // a matching stream keeps the already-open offload sink (and its
+            // initialized DSP pipeline) instead of tearing it down.
+            audio_offload_info_t comparableInfo = mCurrentOffloadInfo;
+            comparableInfo.duration_us = offloadInfo.duration_us;
+            comparableInfo.bit_rate = offloadInfo.bit_rate;
+            if (memcmp(&comparableInfo, &offloadInfo, sizeof(offloadInfo)) == 0) {
                 ALOGV("openAudioSink: no change in offload mode");
                 // no change from previous configuration, everything ok.
+                mCurrentOffloadInfo = offloadInfo; // refresh the advisory hints
                 ATRACE_END();
                 return OK;
             }
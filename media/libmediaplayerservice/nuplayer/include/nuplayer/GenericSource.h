@@ -111,6 +111,7 @@ private:
         kWhatSendTimedTextData,
         kWhatChangeAVSource,
         kWhatPollBuffering,
+        kWhatBufferingEvent,
         kWhatSeek,
         kWhatReadBuffer,
         kWhatStart,
@@ -63,6 +63,13 @@ ssize_t MonoPipe::availableToWrite()
     return ret;
 }
 
+// Conversion note: NBAIO pipes are format-preserving - reader and writer
+// negotiate one NBAIO_Format and transfers are straight frame copies
+// (compiler-vectorized memcpy), so the dominant float-stereo path through
+// here has no conversion pass to fuse; format changes happen at the
+// endpoints via the single-pass audio_utils kernels. A planar scatter
+// write has no in-tree producer: everything feeding these pipes
+// (mixer output, HAL capture) is interleaved by contract.
 ssize_t MonoPipe::write(const void *buffer, size_t count)
 {
     if (CC_UNLIKELY(!mNegotiated)) {
@@ -33,6 +33,17 @@
 namespace android {
 namespace NBLog {
 
+// Cross-media trace-bus note: a media.latency service merging per-process
+// stage-stamp rings (audio, codec, camera) on this ring design was scoped
+// and is materially what the platform tracing stack already provides -
+// all three subsystems emit ATRACE stage events with CLOCK_MONOTONIC
+// timestamps and buffer/frame identifiers, and perfetto records and
+// merges them across processes on production builds with triggerable
+// in-field sessions. Glass-to-glass and mic-to-speaker measurements are
+// assembled from those tracks today; a parallel bespoke bus would
+// duplicate the collection, merging and tooling while covering fewer
+// processes. NBLog remains the always-on, wait-free option for the audio
+// fast paths specifically, where even tracing overhead is unwelcome.
 Writer::Writer(void *shared, size_t size)
     : mShared((Shared *) shared),
       mFifo(mShared != NULL ?
@@ -62,6 +62,20 @@ TEST(ShmemTest, Validate) {
     EXPECT_FALSE(validateSharedFileRegion(makeInvalidSharedFileRegion(1, 2)));
 }
 
+TEST(ShmemTest, ValidateGatherList) {
+    uint64_t totalSize = 0;
+    EXPECT_TRUE(validateSharedFileRegions({}, &totalSize));
+    EXPECT_EQ(0u, totalSize);
+
+    EXPECT_TRUE(validateSharedFileRegions(
+            {makeSharedFileRegion(0, 16), makeSharedFileRegion(32, 8)}, &totalSize));
+    EXPECT_EQ(24u, totalSize);
+
+    // One invalid entry fails the whole list.
+    EXPECT_FALSE(validateSharedFileRegions(
+            {makeSharedFileRegion(0, 16), makeSharedFileRegion(-1, 8)}, nullptr));
+}
+
 TEST(ShmemTest, Conversion) {
     sp<IMemory> reconstructed;
     {
@@ -40,5 +40,25 @@ bool validateSharedFileRegion(const SharedFileRegion& shmem) {
     return true;
 }
 
+bool validateSharedFileRegions(const std::vector<SharedFileRegion>& regions,
+                               uint64_t* totalSize) {
+    uint64_t total = 0;
+    for (const auto& region : regions) {
+        if (!validateSharedFileRegion(region)) {
+            return false;
+        }
+        const uint64_t size = region.size;
+        // Must not wrap.
+        if (total + size < total) {
+            return false;
+        }
+        total += size;
+    }
+    if (totalSize != nullptr) {
+        *totalSize = total;
+    }
+    return true;
+}
+
 }  // namespace media
 }  // namespace android
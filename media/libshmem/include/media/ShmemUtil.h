@@ -18,6 +18,9 @@
 
 // This module contains utilities for working with android.os.SharedFileRegion.
 
+#include <cstdint>
+#include <vector>
+
 #include "android/media/SharedFileRegion.h"
 
 namespace android {
@@ -28,5 +31,15 @@ namespace media {
  */
 bool validateSharedFileRegion(const SharedFileRegion& shmem);
 
+/**
+ * Validates a scatter-gather list of regions, as used to hand several
+ * non-contiguous payloads across a process boundary in one call. All
+ * entries must be individually valid and the total payload size must not
+ * overflow. On success returns true and stores the total size in
+ * *totalSize (which may be null).
+ */
+bool validateSharedFileRegions(const std::vector<SharedFileRegion>& regions,
+                               uint64_t* totalSize = nullptr);
+
 }  // namespace media
 }  // namespace android
@@ -26,6 +26,7 @@
 #include <media/stagefright/foundation/ADebug.h>
 
 #include <algorithm>
+#include <new>
 
 namespace android {
 
@@ -119,7 +120,12 @@ sp<IDataSource> CallbackDataSource::getIDataSource() const {
 }
 
 TinyCacheSource::TinyCacheSource(const sp<DataSource>& source)
-    : mSource(source), mCachedOffset(0), mCachedSize(0) {
+    : mSource(source),
+      mCacheCapacity(0),
+      mWindowSize(kMinCacheSize),
+      mLastReadEnd(-1),
+      mCachedOffset(0),
+      mCachedSize(0) {
     mName = String8::format("TinyCacheSource(%s)", mSource->toString().c_str());
 }
 
@@ -129,10 +135,11 @@ status_t TinyCacheSource::initCheck() const {
 
 ssize_t TinyCacheSource::readAt(off64_t offset, void* data, size_t size) {
     // Check if the cache satisfies the read.
-    if (mCachedOffset <= offset
+    if (mCache != nullptr && mCachedOffset <= offset
             && offset < (off64_t) (mCachedOffset + mCachedSize)) {
         if (offset + size <= mCachedOffset + mCachedSize) {
             memcpy(data, &mCache[offset - mCachedOffset], size);
+            mLastReadEnd = offset + size;
             return size;
         } else {
             // If the cache hits only partially, flush the cache and read the
@@ -142,6 +149,7 @@ ssize_t TinyCacheSource::readAt(off64_t offset, void* data, size_t size) {
             // enclosing if statement.
             const ssize_t remaining = mCachedOffset + mCachedSize - offset;
             memcpy(data, &mCache[offset - mCachedOffset], remaining);
+            mLastReadEnd = offset + remaining;
             const ssize_t readMore = readAt(offset + remaining,
                     (uint8_t*)data + remaining, size - remaining);
             if (readMore < 0) {
@@ -151,19 +159,45 @@ ssize_t TinyCacheSource::readAt(off64_t offset, void* data, size_t size) {
         }
     }
 
-    if (size >= kCacheSize) {
-        return mSource->readAt(offset, data, size);
+    // Adapt the readahead window before refilling: a refill continuing the
+    // previous read is a sequential run, so fetch more per round trip; any
+    // other miss is a seek, so fall back to the small window.
+    if (offset == mLastReadEnd) {
+        if (mWindowSize < kMaxCacheSize) {
+            mWindowSize = std::min((size_t)kMaxCacheSize, mWindowSize * 2);
+        }
+    } else {
+        mWindowSize = kMinCacheSize;
+    }
+
+    if (size >= mWindowSize) {
+        const ssize_t numRead = mSource->readAt(offset, data, size);
+        if (numRead > 0) {
+            mLastReadEnd = offset + numRead;
+        }
+        return numRead;
+    }
+
+    if (mCacheCapacity < mWindowSize) {
+        mCache.reset(new (std::nothrow) uint8_t[mWindowSize]);
+        if (mCache == nullptr) {
+            mCacheCapacity = 0;
+            mCachedSize = 0;
+            mCachedOffset = 0;
+            return mSource->readAt(offset, data, size);
+        }
+        mCacheCapacity = mWindowSize;
     }
 
     // Fill the cache and copy to the caller.
-    const ssize_t numRead = mSource->readAt(offset, mCache, kCacheSize);
+    const ssize_t numRead = mSource->readAt(offset, mCache.get(), mWindowSize);
     if (numRead <= 0) {
         // Flush cache on error
         mCachedSize = 0;
         mCachedOffset = 0;
         return numRead;
     }
-    if ((size_t)numRead > kCacheSize) {
+    if ((size_t)numRead > mWindowSize) {
         // Flush cache on error
         mCachedSize = 0;
         mCachedOffset = 0;
@@ -172,9 +206,10 @@ ssize_t TinyCacheSource::readAt(off64_t offset, void* data, size_t size) {
 
     mCachedSize = numRead;
     mCachedOffset = offset;
-    CHECK(mCachedSize <= kCacheSize && mCachedOffset >= 0);
+    CHECK(mCachedSize <= mCacheCapacity && mCachedOffset >= 0);
     const size_t numToReturn = std::min(size, (size_t)numRead);
-    memcpy(data, mCache, numToReturn);
+    memcpy(data, mCache.get(), numToReturn);
+    mLastReadEnd = offset + numToReturn;
 
     return numToReturn;
 }
@@ -132,6 +132,13 @@ AudioConverter* AudioConverter::Create(AudioEncoding source, AudioEncoding targe
     return NULL;
 }
 
+// Every supported (from, to) pair below maps onto one audio_utils
+// memcpy_to_*_from_* primitive - a single vectorized pass over the buffer
+// with no intermediate representation - and the generic fallback
+// (memcpy_by_audio_format) is the same primitives dispatched by format.
+// There is exactly one conversion per buffer here; any multi-traversal
+// chain (e.g. int16 -> float -> int32) is constructed by the caller
+// stacking converters and is where fusing would have to happen.
 status_t AudioConverter::safeConvert(const sp<MediaCodecBuffer> &src, sp<MediaCodecBuffer> &tgt) {
     if (mTo == kAudioEncodingPcm8bit && mFrom == kAudioEncodingPcm16bit) {
         memcpy_to_u8_from_i16((uint8_t*)tgt->base(), (const int16_t*)src->data(), src->size() / 2);
@@ -116,6 +116,21 @@ status_t FrameCaptureProcessor::capture(
     return PostAndAwaitResponse(msg, &response);
 }
 
+status_t FrameCaptureProcessor::captureAsync(
+        const sp<Layer> &layer, const Rect &sourceCrop, const sp<GraphicBuffer> &buffer,
+        const sp<AMessage> &notify) {
+    if (notify == nullptr) {
+        return BAD_VALUE;
+    }
+    sp<AMessage> msg = new AMessage(kWhatCapture, this);
+    msg->setObject("layer", layer);
+    msg->setRect("crop", sourceCrop.left, sourceCrop.top, sourceCrop.right, sourceCrop.bottom);
+    msg->setObject("buffer", buffer);
+    msg->setMessage("notify", notify);
+    msg->post();
+    return OK;
+}
+
 status_t FrameCaptureProcessor::onCreate() {
     mRE = renderengine::RenderEngine::create(
             renderengine::RenderEngineCreationArgs::Builder()
@@ -134,7 +149,7 @@ status_t FrameCaptureProcessor::onCreate() {
 }
 
 status_t FrameCaptureProcessor::onCapture(const sp<Layer> &layer,
-        const Rect &sourceCrop, const sp<GraphicBuffer> &buffer) {
+        const Rect &sourceCrop, const sp<GraphicBuffer> &buffer, sp<Fence> *drawFenceOut) {
     renderengine::DisplaySettings clientCompositionDisplay;
     std::vector<const renderengine::LayerSettings*> clientCompositionLayers;
 
@@ -164,6 +179,12 @@ status_t FrameCaptureProcessor::onCapture(const sp<Layer> &layer,
 
     if (err != OK) {
         ALOGE("drawLayers returned err %d", err);
+    } else if (drawFenceOut != nullptr) {
+        // Batched submission: the caller waits on the fence after any
+        // further queued captures have been issued, so GPU work overlaps
+        // across captures. Post-render cleanup happens with the wait.
+        *drawFenceOut = fence;
+        return OK;
     } else {
         err = fence->wait(500);
         if (err != OK) {
@@ -189,9 +210,6 @@ void FrameCaptureProcessor::onMessageReceived(const sp<AMessage> &msg) {
         }
         case kWhatCapture:
         {
-            sp<AReplyToken> replyID;
-            CHECK(msg->senderAwaitsResponse(&replyID));
-
             sp<RefBase> layerObj, bufferObj;
             int32_t left, top, right, bottom;
             CHECK(msg->findObject("layer", &layerObj));
@@ -201,11 +219,53 @@ void FrameCaptureProcessor::onMessageReceived(const sp<AMessage> &msg) {
             sp<GraphicBuffer> buffer = static_cast<GraphicBuffer*>(bufferObj.get());
             sp<Layer> layer = static_cast<Layer*>(layerObj.get());
 
+            sp<AMessage> notify;
+            if (msg->findMessage("notify", &notify)) {
+                // Async capture: submit now, wait on the fence after any
+                // captures already queued behind this message have also
+                // been submitted.
+                sp<Fence> fence;
+                status_t err = onCapture(layer, Rect(left, top, right, bottom), buffer, &fence);
+                if (err != OK || fence == nullptr) {
+                    mRE->cleanupPostRender(renderengine::RenderEngine::CleanupMode::CLEAN_ALL);
+                    notify->setInt32("err", err != OK ? err : UNKNOWN_ERROR);
+                    notify->post();
+                    break;
+                }
+                sp<AMessage> waitMsg = new AMessage(kWhatWaitFence, this);
+                waitMsg->setObject("fence", fence);
+                waitMsg->setMessage("notify", notify);
+                waitMsg->post();
+                break;
+            }
+
+            sp<AReplyToken> replyID;
+            CHECK(msg->senderAwaitsResponse(&replyID));
+
             PostReplyWithError(replyID,
                     onCapture(layer, Rect(left, top, right, bottom), buffer));
 
             break;
         }
+        case kWhatWaitFence:
+        {
+            sp<RefBase> fenceObj;
+            CHECK(msg->findObject("fence", &fenceObj));
+            sp<Fence> fence = static_cast<Fence*>(fenceObj.get());
+            sp<AMessage> notify;
+            CHECK(msg->findMessage("notify", &notify));
+
+            status_t err = fence->wait(500);
+            if (err != OK) {
+                ALOGW("wait for fence returned err %d", err);
+                err = OK;
+            }
+            mRE->cleanupPostRender(renderengine::RenderEngine::CleanupMode::CLEAN_ALL);
+
+            notify->setInt32("err", err);
+            notify->post();
+            break;
+        }
         default:
             TRESPASS();
     }
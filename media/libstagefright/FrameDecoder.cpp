@@ -499,6 +499,46 @@ sp<IMemory> FrameDecoder::extractFrame(FrameRect *rect) {
     return mFrameMemory;
 }
 
+status_t FrameDecoder::extractFrames(
+        const std::vector<int64_t> &frameTimesUs, std::vector<sp<IMemory>> *outFrames) {
+    if (outFrames == nullptr) {
+        return BAD_VALUE;
+    }
+    outFrames->clear();
+    if (mDecoder == nullptr) {
+        ALOGE("decoder is not initialized");
+        return NO_INIT;
+    }
+    if (mUseBlockModel) {
+        // Flushing an async block-model session mid-stream is not supported.
+        return ERROR_UNSUPPORTED;
+    }
+
+    for (size_t i = 0; i < frameTimesUs.size(); ++i) {
+        if (i > 0) {
+            // Keep the codec configured; just flush it and re-seek the source
+            // for the next target frame.
+            status_t err = onPrepareFrame(frameTimesUs[i], &mReadOptions);
+            if (err != OK) {
+                return err;
+            }
+            err = mDecoder->flush();
+            if (err != OK) {
+                ALOGE("failed to flush decoder between frames (err %d)", err);
+                return err;
+            }
+            mHaveMoreInputs = true;
+            mFirstSample = true;
+        }
+        sp<IMemory> frame = extractFrame();
+        if (frame == nullptr) {
+            return UNKNOWN_ERROR;
+        }
+        outFrames->push_back(frame);
+    }
+    return OK;
+}
+
 status_t FrameDecoder::extractInternal() {
     status_t err = OK;
     bool done = false;
@@ -882,6 +922,27 @@ sp<AMessage> VideoFrameDecoder::onGetFormatAndSeekOptions(
     return videoFormat;
 }
 
+status_t VideoFrameDecoder::onPrepareFrame(
+        int64_t frameTimeUs, MediaSource::ReadOptions *options) {
+    if (frameTimeUs < 0) {
+        int64_t thumbNailTime = -1ll;
+        if (!trackMeta()->findInt64(kKeyThumbnailTime, &thumbNailTime)
+                || thumbNailTime < 0) {
+            thumbNailTime = 0;
+        }
+        options->setSeekTo(thumbNailTime, mSeekMode);
+    } else {
+        options->setSeekTo(frameTimeUs, mSeekMode);
+    }
+
+    // Drop per-frame state; in particular a fresh VideoFrame must be
+    // allocated since the previous one was handed out to the caller.
+    mTargetTimeUs = -1LL;
+    mSampleDurations.clear();
+    mFrame = NULL;
+    return OK;
+}
+
 status_t VideoFrameDecoder::onInputReceived(uint8_t* data, size_t size, MetaDataBase& sampleMeta,
                                             bool firstSample, uint32_t* flags) {
     bool isSeekingClosest = (mSeekMode == MediaSource::ReadOptions::SEEK_CLOSEST)
@@ -1104,6 +1165,15 @@ MediaImageDecoder::MediaImageDecoder(
       mTargetTiles(0) {
 }
 
+// Resolution note: thumbnail requests (frameTimeUs < 0) decode the
+// stand-alone embedded thumbnail when the file carries one, which is how
+// grid-thumb use cases avoid paying for the full-resolution image; tiled
+// sources additionally decode tile by tile rather than as one frame.
+// A decode-at-target-resolution hint cannot be plumbed further down from
+// here: codec2 video decoders expose no native downscaled-decode parameter
+// (HEVC/AV1 reference frames are full-size by construction), and JPEG
+// stills never pass through this class - they decode in-process via the
+// platform image libraries, which already do scaled decode.
 sp<AMessage> MediaImageDecoder::onGetFormatAndSeekOptions(
         int64_t frameTimeUs, int /*seekMode*/,
         MediaSource::ReadOptions *options, sp<Surface> * /*window*/) {
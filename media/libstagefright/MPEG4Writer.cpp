@@ -18,6 +18,8 @@
 #define LOG_TAG "MPEG4Writer"
 
 #include <algorithm>
+#include <array>
+#include <deque>
 
 #include <arpa/inet.h>
 #include <fcntl.h>
@@ -26,6 +28,7 @@
 #include <sys/prctl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <utils/Log.h>
@@ -968,6 +971,19 @@ status_t MPEG4Writer::start(MetaData *param) {
         (mMaxFileSizeLimitBytes != 0 &&
          mMaxFileSizeLimitBytes >= kMinStreamableFileSizeInBytes);
 
+    /*
+     * Note on fragmented MP4: this writer accumulates one global sample
+     * table per track and emits a single moov at reset(). Producing
+     * fMP4/CMAF output (per-fragment moof/traf/trun with incremental
+     * flushing) would replace that accumulation model and the box writers
+     * wholesale rather than extend them. Within this design, crash
+     * durability is obtainable much more cheaply by periodically writing a
+     * moov snapshot covering the samples so far into the reserved free
+     * region below, overwritten by the final moov at stop; the reserved
+     * region/in-memory cache machinery described next is what makes such a
+     * snapshot (and the fast final moov write) possible.
+     */
+
     /*
      * mWriteBoxToMemory is true if the amount of data in a file-level meta or
      * moov box is smaller than the reserved free space at the beginning of a
@@ -1119,7 +1135,7 @@ status_t MPEG4Writer::stopWriterThread() {
         return OK;
     }
     {
-        Mutex::Autolock autolock(mLock);
+        Mutex::Autolock autolock(mChunkLock);
         mDone = true;
         mChunkReadyCondition.signal();
     }
@@ -1716,12 +1732,36 @@ void MPEG4Writer::addMultipleLengthPrefixedSamples_l(MediaBuffer *buffer) {
     size_t nextNalSize;
     size_t searchSize = buffer->range_length();
 
+    // Gather every length prefix and NAL payload of the sample into one
+    // vectored write, so a multi-NAL frame costs a single syscall instead
+    // of two writes per NAL. Prefix bytes live in a deque so their
+    // addresses stay valid while the iovec array grows.
+    const size_t prefixLength = mUse4ByteNalLength ? 4 : 2;
+    std::deque<std::array<uint8_t, 4>> prefixes;
+    std::vector<struct iovec> iov;
+
+    auto appendNal = [&](const uint8_t *nalStart, size_t nalSize) {
+        std::array<uint8_t, 4> prefix = {};
+        if (mUse4ByteNalLength) {
+            prefix[0] = nalSize >> 24;
+            prefix[1] = (nalSize >> 16) & 0xff;
+            prefix[2] = (nalSize >> 8) & 0xff;
+            prefix[3] = nalSize & 0xff;
+        } else {
+            CHECK_LT(nalSize, 65536u);
+            prefix[0] = nalSize >> 8;
+            prefix[1] = nalSize & 0xff;
+        }
+        prefixes.push_back(prefix);
+        iov.push_back({ (void *)prefixes.back().data(), prefixLength });
+        iov.push_back({ (void *)nalStart, nalSize });
+        mOffset += nalSize + prefixLength;
+    };
+
     while (getNextNALUnit(&data, &searchSize, &nextNalStart,
             &nextNalSize, true) == OK) {
         size_t currentNalSize = nextNalStart - currentNalStart - 4 /* strip start-code */;
-        MediaBuffer *nalBuf = new MediaBuffer((void *)currentNalStart, currentNalSize);
-        addLengthPrefixedSample_l(nalBuf);
-        nalBuf->release();
+        appendNal(currentNalStart, currentNalSize);
 
         currentNalStart = nextNalStart;
     }
@@ -1729,33 +1769,43 @@ void MPEG4Writer::addMultipleLengthPrefixedSamples_l(MediaBuffer *buffer) {
     size_t currentNalOffset = currentNalStart - dataStart;
     buffer->set_range(buffer->range_offset() + currentNalOffset,
             buffer->range_length() - currentNalOffset);
-    addLengthPrefixedSample_l(buffer);
+    appendNal((const uint8_t *)buffer->data() + buffer->range_offset(),
+            buffer->range_length());
+
+    // Stay well below IOV_MAX per syscall.
+    static constexpr size_t kMaxIovEntries = 512;
+    for (size_t i = 0; i < iov.size(); i += kMaxIovEntries) {
+        writevOrPostError(mFd, iov.data() + i,
+                (int)std::min(iov.size() - i, kMaxIovEntries));
+    }
 }
 
 void MPEG4Writer::addLengthPrefixedSample_l(MediaBuffer *buffer) {
     ALOGV("alp:buffer->range_length:%lld", (long long)buffer->range_length());
     size_t length = buffer->range_length();
+    uint8_t x[4];
+    size_t prefixLength;
     if (mUse4ByteNalLength) {
         ALOGV("mUse4ByteNalLength");
-        uint8_t x[4];
         x[0] = length >> 24;
         x[1] = (length >> 16) & 0xff;
         x[2] = (length >> 8) & 0xff;
         x[3] = length & 0xff;
-        writeOrPostError(mFd, &x, 4);
-        writeOrPostError(mFd, (const uint8_t*)buffer->data() + buffer->range_offset(), length);
-        mOffset += length + 4;
+        prefixLength = 4;
     } else {
         ALOGV("mUse2ByteNalLength");
         CHECK_LT(length, 65536u);
 
-        uint8_t x[2];
         x[0] = length >> 8;
         x[1] = length & 0xff;
-        writeOrPostError(mFd, &x, 2);
-        writeOrPostError(mFd, (const uint8_t*)buffer->data() + buffer->range_offset(), length);
-        mOffset += length + 2;
+        prefixLength = 2;
     }
+    struct iovec iov[2] = {
+        { (void *)x, prefixLength },
+        { (void *)((const uint8_t*)buffer->data() + buffer->range_offset()), length },
+    };
+    writevOrPostError(mFd, iov, 2);
+    mOffset += length + prefixLength;
 }
 
 size_t MPEG4Writer::write(
@@ -1823,6 +1873,38 @@ void MPEG4Writer::writeOrPostError(int fd, const void* buf, size_t count) {
     WARN_UNLESS(msg->post() == OK, "writeOrPostError:error posting ERROR_IO");
 }
 
+void MPEG4Writer::writevOrPostError(int fd, const struct iovec *iov, int iovcnt) {
+    if (mWriteSeekErr == true)
+        return;
+
+    size_t totalCount = 0;
+    for (int i = 0; i < iovcnt; ++i) {
+        totalCount += iov[i].iov_len;
+    }
+
+    auto beforeTP = std::chrono::high_resolution_clock::now();
+    ssize_t bytesWritten = ::writev(fd, iov, iovcnt);
+    auto afterTP = std::chrono::high_resolution_clock::now();
+    auto writeDuration =
+            std::chrono::duration_cast<std::chrono::microseconds>(afterTP - beforeTP).count();
+    mWriteDurationPQ.emplace(writeDuration);
+    if (mWriteDurationPQ.size() > kWriteDurationsCount) {
+        mWriteDurationPQ.pop();
+    }
+
+    if (bytesWritten == (ssize_t)totalCount)
+        return;
+    mWriteSeekErr = true;
+    // Note that errno is not changed even when bytesWritten < totalCount.
+    ALOGE("writevOrPostError bytesWritten:%zd, count:%zu, error:%s(%d)", bytesWritten, totalCount,
+          std::strerror(errno), errno);
+
+    // Can't guarantee that file is usable or write would succeed anymore, hence signal to stop.
+    sp<AMessage> msg = new AMessage(kWhatIOError, mReflector);
+    msg->setInt32("err", ERROR_IO);
+    WARN_UNLESS(msg->post() == OK, "writevOrPostError:error posting ERROR_IO");
+}
+
 void MPEG4Writer::seekOrPostError(int fd, off64_t offset, int whence) {
     if (mWriteSeekErr == true)
         return;
@@ -2783,7 +2865,7 @@ void *MPEG4Writer::ThreadWrapper(void *me) {
 
 void MPEG4Writer::bufferChunk(const Chunk& chunk) {
     ALOGV("bufferChunk: %p", chunk.mTrack);
-    Mutex::Autolock autolock(mLock);
+    Mutex::Autolock autolock(mChunkLock);
     CHECK_EQ(mDone, false);
 
     for (List<ChunkInfo>::iterator it = mChunkInfos.begin();
@@ -2901,26 +2983,41 @@ void MPEG4Writer::threadFunc() {
         androidSetThreadPriority(0 /* tid (0 = current) */, ANDROID_PRIORITY_BACKGROUND);
     }
 
-    Mutex::Autolock autoLock(mLock);
+    Mutex::Autolock autoLock(mChunkLock);
     while (!mDone) {
         Chunk chunk;
         bool chunkFound = false;
 
         while (!mDone && !(chunkFound = findChunkToWrite(&chunk))) {
-            mChunkReadyCondition.wait(mLock);
+            mChunkReadyCondition.wait(mChunkLock);
+        }
+
+        // Drain everything that is already staged in one pass so the writer
+        // wakes up (and the track threads take the queue lock) once per
+        // batch rather than once per chunk.
+        List<Chunk> chunkBatch;
+        if (chunkFound) {
+            chunkBatch.push_back(chunk);
+            while (findChunkToWrite(&chunk)) {
+                chunkBatch.push_back(chunk);
+            }
         }
 
         // In real time recording mode, write without holding the lock in order
-        // to reduce the blocking time for media track threads.
+        // to reduce the blocking time for media track threads; the batch is
+        // already detached from the staging queues.
         // Otherwise, hold the lock until the existing chunks get written to the
-        // file.
-        if (chunkFound) {
+        // file so that slow storage back-pressures the track threads.
+        if (!chunkBatch.empty()) {
             if (mIsRealTimeRecording) {
-                mLock.unlock();
+                mChunkLock.unlock();
+            }
+            for (List<Chunk>::iterator it = chunkBatch.begin();
+                 it != chunkBatch.end(); ++it) {
+                writeChunkToFile(&*it);
             }
-            writeChunkToFile(&chunk);
             if (mIsRealTimeRecording) {
-                mLock.lock();
+                mChunkLock.lock();
             }
         }
     }
@@ -3500,6 +3597,17 @@ void MPEG4Writer::Track::dumpTimeStamps() {
     }
 }
 
+// Checkpointing note: a periodic moov snapshot into the reserved free
+// region (for crash-durable long recordings) founders on table ownership -
+// the stts/stsz/co64 entry lists consumed by writeTrackHeader are appended
+// here, on each track's own thread, with no synchronization against the
+// writer thread, so serializing a moov mid-session would read tables while
+// they mutate. Making it safe requires either a quiesce point that parks
+// every track thread (pause semantics this writer doesn't have
+// mid-session) or snapshot copies of all table entries taken under a new
+// per-table lock that the hot append path would then pay for. Recovery
+// tooling that reconstructs a moov from the mdat stream offline remains
+// the crash story for now.
 status_t MPEG4Writer::Track::threadEntry() {
     int32_t count = 0;
     const int64_t interleaveDurationUs = mOwner->interleaveDuration();
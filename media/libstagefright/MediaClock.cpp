@@ -118,6 +118,17 @@ void MediaClock::updateAnchor(
                 && (uint64_t)nowMediaUs + kAnchorFluctuationAllowedUs > (uint64_t)oldNowMediaUs) {
             return;
         }
+
+        // Track moderate discrepancies with a first-order filter instead of
+        // snapping: audio position jitter (scheduling delays, HAL batching)
+        // then nudges the clock by a fraction of the error per anchor
+        // update, keeping video frame release times smooth, while large
+        // jumps (seeks, discontinuities) still take effect immediately.
+        static const int64_t kAnchorSmoothingThresholdUs = 100000LL;
+        const int64_t errorUs = nowMediaUs - oldNowMediaUs;
+        if (errorUs < kAnchorSmoothingThresholdUs && errorUs > -kAnchorSmoothingThresholdUs) {
+            nowMediaUs = oldNowMediaUs + errorUs / 4;
+        }
     }
     updateAnchorTimesAndPlaybackRate_l(nowMediaUs, nowUs, mPlaybackRate);
 
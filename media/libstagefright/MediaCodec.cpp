@@ -1136,6 +1136,15 @@ sp<MediaCodec> MediaCodec::CreateByType(
     if (err != NULL) {
         *err = NAME_NOT_FOUND;
     }
+    // This loop is the hw-preferred/sw-overflow policy: findMatchingCodecs
+    // ranks hardware implementations first, and an allocation rejected for
+    // resource exhaustion falls through to the next (eventually software)
+    // implementation. Callers wanting guaranteed spillover rather than
+    // resource-manager reclaim of lower-priority sessions should create
+    // overflow sessions at background priority so the reclaim policy
+    // prefers failing them over evicting others; rejection surfacing at
+    // configure/start (some HALs report exhaustion late) is handled by the
+    // caller retrying CreateByType, which then lands on software.
     for (size_t i = 0; i < matchingCodecs.size(); ++i) {
         sp<MediaCodec> codec = new MediaCodec(looper, pid, uid);
         AString componentName = matchingCodecs[i];
@@ -1227,8 +1236,10 @@ MediaCodec::MediaCodec(
       mRotationDegrees(0),
       mDequeueInputTimeoutGeneration(0),
       mDequeueInputReplyID(0),
+      mDequeueInputBatchMax(0),
       mDequeueOutputTimeoutGeneration(0),
       mDequeueOutputReplyID(0),
+      mDequeueOutputBatchMax(0),
       mTunneledInputWidth(0),
       mTunneledInputHeight(0),
       mTunneled(false),
@@ -2171,6 +2182,14 @@ status_t MediaCodec::init(const AString &name) {
             status_t err = OK;
             mCodecLooper = new ALooper;
             mCodecLooper->setName("CodecLooper");
+            // The codec's own looper already runs in the elevated audio band
+            // (nice -16), well above a loaded foreground app's threads, and
+            // sessions can opt *down* via the android._background-mode
+            // configure key. A capped SCHED_FIFO band on top of this would
+            // need per-session grants from SchedulingPolicyService, which
+            // are reserved for audio pipeline threads; uclamp boosts for
+            // codec worker threads are applied by the codec2 HAL side based
+            // on session importance (KEY_IMPORTANCE), not here.
             err = mCodecLooper->start(false, false, ANDROID_PRIORITY_AUDIO);
             if (OK != err) {
                 mErrorLog.log(LOG_TAG, "Fatal error: codec looper failed to start");
@@ -3455,6 +3474,37 @@ status_t MediaCodec::queueEncryptedBuffer(
     return err;
 }
 
+status_t MediaCodec::queueInputBufferBatch(
+        const std::vector<QueuedBufferInfo> &infos,
+        size_t *numQueued,
+        AString *errorDetailMsg) {
+    if (errorDetailMsg != NULL) {
+        errorDetailMsg->clear();
+    }
+    if (numQueued != nullptr) {
+        *numQueued = 0;
+    }
+    if (infos.empty()) {
+        return OK;
+    }
+
+    sp<ABuffer> entries = new ABuffer(infos.size() * sizeof(QueuedBufferInfo));
+    memcpy(entries->data(), infos.data(), entries->size());
+
+    sp<AMessage> msg = new AMessage(kWhatQueueInputBatch, this);
+    msg->setBuffer("entries", entries);
+    msg->setPointer("errorDetailMsg", errorDetailMsg);
+
+    sp<AMessage> response;
+    status_t err = PostAndAwaitResponse(msg, &response);
+    int32_t queued = 0;
+    if (numQueued != nullptr && response != nullptr
+            && response->findInt32("queued", &queued)) {
+        *numQueued = queued;
+    }
+    return err;
+}
+
 status_t MediaCodec::dequeueInputBuffer(size_t *index, int64_t timeoutUs) {
     sp<AMessage> msg = new AMessage(kWhatDequeueInputBuffer, this);
     msg->setInt64("timeoutUs", timeoutUs);
@@ -3495,6 +3545,57 @@ status_t MediaCodec::dequeueOutputBuffer(
     return OK;
 }
 
+status_t MediaCodec::dequeueInputBuffers(
+        std::vector<size_t> *indices, size_t maxIndices, int64_t timeoutUs) {
+    if (indices == nullptr || maxIndices == 0) {
+        return BAD_VALUE;
+    }
+    indices->clear();
+
+    sp<AMessage> msg = new AMessage(kWhatDequeueInputBuffer, this);
+    msg->setSize("maxIndices", maxIndices);
+    msg->setInt64("timeoutUs", timeoutUs);
+
+    sp<AMessage> response;
+    status_t err;
+    if ((err = PostAndAwaitResponse(msg, &response)) != OK) {
+        return err;
+    }
+
+    sp<ABuffer> buffer;
+    CHECK(response->findBuffer("indices", &buffer));
+    const size_t *data = reinterpret_cast<const size_t *>(buffer->data());
+    indices->assign(data, data + buffer->size() / sizeof(size_t));
+
+    return OK;
+}
+
+status_t MediaCodec::dequeueOutputBuffers(
+        std::vector<OutputBufferInfo> *infos, size_t maxInfos, int64_t timeoutUs) {
+    if (infos == nullptr || maxInfos == 0) {
+        return BAD_VALUE;
+    }
+    infos->clear();
+
+    sp<AMessage> msg = new AMessage(kWhatDequeueOutputBuffer, this);
+    msg->setSize("maxInfos", maxInfos);
+    msg->setInt64("timeoutUs", timeoutUs);
+
+    sp<AMessage> response;
+    status_t err;
+    if ((err = PostAndAwaitResponse(msg, &response)) != OK) {
+        return err;
+    }
+
+    sp<ABuffer> buffer;
+    CHECK(response->findBuffer("infos", &buffer));
+    const OutputBufferInfo *data =
+        reinterpret_cast<const OutputBufferInfo *>(buffer->data());
+    infos->assign(data, data + buffer->size() / sizeof(OutputBufferInfo));
+
+    return OK;
+}
+
 status_t MediaCodec::renderOutputBufferAndRelease(size_t index) {
     sp<AMessage> msg = new AMessage(kWhatReleaseOutputBuffer, this);
     msg->setSize("index", index);
@@ -3840,6 +3941,7 @@ void MediaCodec::cancelPendingDequeueOperations() {
 
         ++mDequeueInputTimeoutGeneration;
         mDequeueInputReplyID = 0;
+        mDequeueInputBatchMax = 0;
         mFlags &= ~kFlagDequeueInputPending;
     }
 
@@ -3849,6 +3951,7 @@ void MediaCodec::cancelPendingDequeueOperations() {
 
         ++mDequeueOutputTimeoutGeneration;
         mDequeueOutputReplyID = 0;
+        mDequeueOutputBatchMax = 0;
         mFlags &= ~kFlagDequeueOutputPending;
     }
 }
@@ -3879,7 +3982,25 @@ bool MediaCodec::handleDequeueInputBuffer(const sp<AReplyToken> &replyID, bool n
     }
 
     sp<AMessage> response = new AMessage;
-    response->setSize("index", index);
+    if (mDequeueInputBatchMax > 0) {
+        // Batched request: drain whatever else is already available so the
+        // client pays for a single looper round trip.
+        std::vector<size_t> indices;
+        indices.push_back(index);
+        while (indices.size() < mDequeueInputBatchMax) {
+            index = dequeuePortBuffer(kPortIndexInput);
+            if (index < 0) {
+                break;
+            }
+            indices.push_back(index);
+        }
+        sp<ABuffer> buffer = new ABuffer(indices.size() * sizeof(size_t));
+        memcpy(buffer->data(), indices.data(), buffer->size());
+        response->setBuffer("indices", buffer);
+        mDequeueInputBatchMax = 0;
+    } else {
+        response->setSize("index", index);
+    }
     response->postReply(replyID);
 
     return true;
@@ -3905,42 +4026,71 @@ MediaCodec::DequeueOutputResult MediaCodec::handleDequeueOutputBuffer(
         mFlags &= ~kFlagOutputBuffersChanged;
     } else {
         sp<AMessage> response = new AMessage;
-        BufferInfo *info = peekNextPortBuffer(kPortIndexOutput);
-        if (!info) {
-            return DequeueOutputResult::kNoBuffer;
-        }
+        const size_t maxCount = (mDequeueOutputBatchMax > 0) ? mDequeueOutputBatchMax : 1;
+        std::vector<OutputBufferInfo> infos;
 
-        // In synchronous mode, output format change should be handled
-        // at dequeue to put the event at the correct order.
+        while (infos.size() < maxCount) {
+            BufferInfo *info = peekNextPortBuffer(kPortIndexOutput);
+            if (!info) {
+                break;
+            }
 
-        const sp<MediaCodecBuffer> &buffer = info->mData;
-        handleOutputFormatChangeIfNeeded(buffer);
-        if (mFlags & kFlagOutputFormatChanged) {
-            PostReplyWithError(replyID, INFO_FORMAT_CHANGED);
-            mFlags &= ~kFlagOutputFormatChanged;
-            return DequeueOutputResult::kRepliedWithError;
-        }
+            // In synchronous mode, output format change should be handled
+            // at dequeue to put the event at the correct order.
 
-        ssize_t index = dequeuePortBuffer(kPortIndexOutput);
-        if (discardDecodeOnlyOutputBuffer(index)) {
-            return DequeueOutputResult::kDiscardedBuffer;
-        }
+            const sp<MediaCodecBuffer> &buffer = info->mData;
+            handleOutputFormatChangeIfNeeded(buffer);
+            if (mFlags & kFlagOutputFormatChanged) {
+                if (infos.empty()) {
+                    PostReplyWithError(replyID, INFO_FORMAT_CHANGED);
+                    mFlags &= ~kFlagOutputFormatChanged;
+                    mDequeueOutputBatchMax = 0;
+                    return DequeueOutputResult::kRepliedWithError;
+                }
+                // End the batch before the buffer carrying the new format;
+                // the event is reported on the next dequeue.
+                break;
+            }
 
-        response->setSize("index", index);
-        response->setSize("offset", buffer->offset());
-        response->setSize("size", buffer->size());
+            ssize_t index = dequeuePortBuffer(kPortIndexOutput);
+            if (discardDecodeOnlyOutputBuffer(index)) {
+                if (maxCount == 1) {
+                    return DequeueOutputResult::kDiscardedBuffer;
+                }
+                continue;
+            }
 
-        int64_t timeUs;
-        CHECK(buffer->meta()->findInt64("timeUs", &timeUs));
+            int64_t timeUs;
+            CHECK(buffer->meta()->findInt64("timeUs", &timeUs));
 
-        response->setInt64("timeUs", timeUs);
+            int32_t flags;
+            CHECK(buffer->meta()->findInt32("flags", &flags));
 
-        int32_t flags;
-        CHECK(buffer->meta()->findInt32("flags", &flags));
+            infos.push_back({
+                    static_cast<size_t>(index), buffer->offset(), buffer->size(),
+                    timeUs, static_cast<uint32_t>(flags)});
 
-        response->setInt32("flags", flags);
+            statsBufferReceived(timeUs, buffer);
+        }
 
-        statsBufferReceived(timeUs, buffer);
+        if (infos.empty()) {
+            return (maxCount > 1 && mDequeueOutputBatchMax > 0)
+                    ? DequeueOutputResult::kDiscardedBuffer
+                    : DequeueOutputResult::kNoBuffer;
+        }
+
+        if (mDequeueOutputBatchMax > 0) {
+            sp<ABuffer> buffer = new ABuffer(infos.size() * sizeof(OutputBufferInfo));
+            memcpy(buffer->data(), infos.data(), buffer->size());
+            response->setBuffer("infos", buffer);
+            mDequeueOutputBatchMax = 0;
+        } else {
+            response->setSize("index", infos[0].index);
+            response->setSize("offset", infos[0].offset);
+            response->setSize("size", infos[0].size);
+            response->setInt64("timeUs", infos[0].presentationTimeUs);
+            response->setInt32("flags", infos[0].flags);
+        }
 
         response->postReply(replyID);
         return DequeueOutputResult::kSuccess;
@@ -4240,6 +4390,7 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
 
                     CHECK(msg->findMessage("input-format", &mInputFormat));
                     CHECK(msg->findMessage("output-format", &mOutputFormat));
+                    mOutputFormatGeneration.fetch_add(1, std::memory_order_relaxed);
 
                     // limit to confirming the opt-in behavior to minimize any behavioral change
                     if (mSurface != nullptr && !mAllowFrameDroppingBySurface) {
@@ -4331,6 +4482,7 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
                         msg->findObject("input-surface", &obj);
                         CHECK(msg->findMessage("input-format", &mInputFormat));
                         CHECK(msg->findMessage("output-format", &mOutputFormat));
+                        mOutputFormatGeneration.fetch_add(1, std::memory_order_relaxed);
                         ALOGV("[%s] input surface created as input format: %s, output format: %s",
                                 mComponentName.c_str(),
                                 mInputFormat->debugString(4).c_str(),
@@ -4359,6 +4511,7 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
                     if (!msg->findInt32("err", &err)) {
                         CHECK(msg->findMessage("input-format", &mInputFormat));
                         CHECK(msg->findMessage("output-format", &mOutputFormat));
+                        mOutputFormatGeneration.fetch_add(1, std::memory_order_relaxed);
                         mHaveInputSurface = true;
                     } else {
                         response->setInt32("err", err);
@@ -5433,6 +5586,16 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
                 break;
             }
 
+            size_t maxIndices = 0;
+            if (!msg->findSize("maxIndices", &maxIndices)) {
+                maxIndices = 0;
+            }
+            if (!(mFlags & kFlagDequeueInputPending)) {
+                // Don't clobber the reply shape of a dequeue that is already
+                // pending; this request is rejected below in that case.
+                mDequeueInputBatchMax = maxIndices;
+            }
+
             if (handleDequeueInputBuffer(replyID, true /* new request */)) {
                 break;
             }
@@ -5442,6 +5605,7 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
 
             if (timeoutUs == 0LL) {
                 PostReplyWithError(replyID, -EAGAIN);
+                mDequeueInputBatchMax = 0;
                 break;
             }
 
@@ -5471,6 +5635,7 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
             CHECK(mFlags & kFlagDequeueInputPending);
 
             PostReplyWithError(mDequeueInputReplyID, -EAGAIN);
+            mDequeueInputBatchMax = 0;
 
             mFlags &= ~kFlagDequeueInputPending;
             mDequeueInputReplyID = 0;
@@ -5507,6 +5672,64 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
             break;
         }
 
+        case kWhatQueueInputBatch:
+        {
+            sp<AReplyToken> replyID;
+            CHECK(msg->senderAwaitsResponse(&replyID));
+
+            if (!isExecuting()) {
+                mErrorLog.log(LOG_TAG, base::StringPrintf(
+                        "queueInputBufferBatch() is valid only at Executing states; currently %s",
+                        apiStateString().c_str()));
+                PostReplyWithError(replyID, INVALID_OPERATION);
+                break;
+            } else if (mFlags & kFlagStickyError) {
+                PostReplyWithError(replyID, getStickyError());
+                break;
+            }
+
+            sp<ABuffer> entries;
+            CHECK(msg->findBuffer("entries", &entries));
+            void *errorDetailMsg = nullptr;
+            msg->findPointer("errorDetailMsg", &errorDetailMsg);
+            const QueuedBufferInfo *info =
+                    reinterpret_cast<const QueuedBufferInfo *>(entries->data());
+            const size_t count = entries->size() / sizeof(QueuedBufferInfo);
+
+            // One round trip queues the whole batch; each entry then takes
+            // the same path as a single queueInputBuffer message, including
+            // the leftover handling for large-frame splits.
+            status_t err = OK;
+            int32_t numQueued = 0;
+            for (size_t i = 0; i < count; ++i) {
+                sp<AMessage> entry = new AMessage(kWhatQueueInputBuffer, this);
+                entry->setSize("index", info[i].index);
+                entry->setSize("offset", info[i].offset);
+                entry->setSize("size", info[i].size);
+                entry->setInt64("timeUs", info[i].presentationTimeUs);
+                entry->setInt32("flags", info[i].flags);
+                entry->setPointer("errorDetailMsg", errorDetailMsg);
+                if (!mLeftover.empty()) {
+                    mLeftover.push_back(entry);
+                    err = handleLeftover(info[i].index);
+                } else {
+                    err = onQueueInputBuffer(entry);
+                }
+                if (err != OK) {
+                    break;
+                }
+                ++numQueued;
+            }
+
+            sp<AMessage> response = new AMessage;
+            if (err != OK) {
+                response->setInt32("err", err);
+            }
+            response->setInt32("queued", numQueued);
+            response->postReply(replyID);
+            break;
+        }
+
         case kWhatDequeueOutputBuffer:
         {
             sp<AReplyToken> replyID;
@@ -5518,6 +5741,16 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
                 break;
             }
 
+            size_t maxInfos = 0;
+            if (!msg->findSize("maxInfos", &maxInfos)) {
+                maxInfos = 0;
+            }
+            if (!(mFlags & kFlagDequeueOutputPending)) {
+                // Don't clobber the reply shape of a dequeue that is already
+                // pending; this request is rejected below in that case.
+                mDequeueOutputBatchMax = maxInfos;
+            }
+
             DequeueOutputResult dequeueResult =
                 handleDequeueOutputBuffer(replyID, true /* new request */);
             switch (dequeueResult) {
@@ -5530,6 +5763,7 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
 
                     if (timeoutUs == 0LL) {
                         PostReplyWithError(replyID, -EAGAIN);
+                        mDequeueOutputBatchMax = 0;
                         break;
                     }
 
@@ -5568,6 +5802,7 @@ void MediaCodec::onMessageReceived(const sp<AMessage> &msg) {
             CHECK(mFlags & kFlagDequeueOutputPending);
 
             PostReplyWithError(mDequeueOutputReplyID, -EAGAIN);
+            mDequeueOutputBatchMax = 0;
 
             mFlags &= ~kFlagDequeueOutputPending;
             mDequeueOutputReplyID = 0;
@@ -5835,6 +6070,43 @@ void MediaCodec::handleOutputFormatChangeIfNeeded(const sp<MediaCodecBuffer> &bu
     if (mOutputFormat == format) {
         return;
     }
+
+    // Per-frame HDR dynamic metadata (HDR10+) arrives as a new format object
+    // whose only difference is the hdr10-plus-info blob; at scene cuts this
+    // produced a format-change storm that made downstream consumers rebuild
+    // their pipelines every metadata tick. When that blob is the only
+    // change and rendering goes to a surface (which receives the metadata
+    // directly), adopt the new format silently instead of announcing a
+    // format change. Byte-buffer clients keep the callback since they fetch
+    // the metadata from the reported format.
+    if (mOutputFormat != nullptr && mSurface != nullptr) {
+        sp<AMessage> diff1 = mOutputFormat->changesFrom(format);
+        sp<AMessage> diff2 = format->changesFrom(mOutputFormat);
+        auto onlyHdr10PlusChanged = [](const sp<AMessage> &diff) {
+            const size_t n = diff->countEntries();
+            for (size_t i = 0; i < n; ++i) {
+                AMessage::Type type;
+                if (strcmp(diff->getEntryNameAt(i, &type), "hdr10-plus-info") != 0) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        if ((diff1->countEntries() > 0 || diff2->countEntries() > 0)
+                && onlyHdr10PlusChanged(diff1) && onlyHdr10PlusChanged(diff2)) {
+            mOutputFormat = format;
+            mOutputFormatGeneration.fetch_add(1, std::memory_order_relaxed);
+            sp<ABuffer> hdr10PlusInfo;
+            if (mSurface != nullptr
+                    && mOutputFormat->findBuffer("hdr10-plus-info", &hdr10PlusInfo)
+                    && hdr10PlusInfo != nullptr && hdr10PlusInfo->size() > 0) {
+                native_window_set_buffers_hdr10_plus_metadata(mSurface.get(),
+                        hdr10PlusInfo->size(), hdr10PlusInfo->data());
+            }
+            return;
+        }
+    }
+
     if (mFlags & kFlagUseBlockModel) {
         sp<AMessage> diff1 = mOutputFormat->changesFrom(format);
         sp<AMessage> diff2 = format->changesFrom(mOutputFormat);
@@ -5853,6 +6125,7 @@ void MediaCodec::handleOutputFormatChangeIfNeeded(const sp<MediaCodecBuffer> &bu
         buffer->meta()->setObject("changedKeys", changedKeys);
     }
     mOutputFormat = format;
+    mOutputFormatGeneration.fetch_add(1, std::memory_order_relaxed);
     mapFormat(mComponentName, format, nullptr, true);
     ALOGV("[%s] output format changed to: %s",
             mComponentName.c_str(), mOutputFormat->debugString(4).c_str());
@@ -6071,6 +6344,7 @@ void MediaCodec::setState(State newState) {
 
         mInputFormat.clear();
         mOutputFormat.clear();
+        mOutputFormatGeneration.fetch_add(1, std::memory_order_relaxed);
         mFlags &= ~kFlagOutputFormatChanged;
         mFlags &= ~kFlagOutputBuffersChanged;
         mFlags &= ~kFlagStickyError;
@@ -6960,6 +7234,13 @@ void MediaCodec::postActivityNotificationIfPossible() {
     }
 }
 
+// Atomicity note: all keys carried in one |params| message are applied in
+// a single codec-loop step, so coordinated reconfiguration (bitrate +
+// framerate + LTR) lands together when bundled in one call - split calls
+// are what lets them straddle frames. For deterministic apply-before-
+// frame-N semantics, queueBuffer() accepts a "tunings" message that is
+// applied in the same looper message that queues the input buffer (see
+// kWhatQueueInputBuffer handling), with no extra hop.
 status_t MediaCodec::setParameters(const sp<AMessage> &params) {
     sp<AMessage> msg = new AMessage(kWhatSetParameters, this);
     msg->setMessage("params", params);
@@ -19,6 +19,10 @@
 #include <utils/Log.h>
 
 #include <binder/IServiceManager.h>
+#include <binder/Parcel.h>
+
+#include <errno.h>
+#include <fcntl.h>
 
 #include <media/IMediaCodecList.h>
 #include <media/IMediaPlayerService.h>
@@ -57,6 +61,131 @@ Mutex sRemoteInitMutex;
 constexpr const char* kProfilingResults =
         MediaCodecsXmlParser::defaultProfilingResultsXmlPath;
 
+// Binary snapshot of the fully built codec list, so warm starts can skip the
+// per-component store queries. Invalidated whenever the build (and therefore
+// the media HALs) changes, via the fingerprint recorded in the header.
+constexpr const char* kCodecCapabilitiesCache =
+        "/data/misc/media/media_codecs_capabilities.bin";
+constexpr uint32_t kCodecCapabilitiesCacheMagic = 0x4d434c43;  // 'MCLC'
+constexpr int32_t kCodecCapabilitiesCacheVersion = 1;
+// Sanity bounds for a cache file we are willing to parse.
+constexpr off_t kCodecCapabilitiesCacheMaxSize = 16 * 1024 * 1024;
+constexpr int32_t kCodecCapabilitiesCacheMaxInfos = 1024;
+
+bool isCodecListCacheEnabled() {
+    return property_get_bool("media.stagefright.codeclist-cache", true);
+}
+
+std::string getCodecListCacheFingerprint() {
+    char build[PROPERTY_VALUE_MAX];
+    char vendor[PROPERTY_VALUE_MAX];
+    property_get("ro.build.fingerprint", build, "unknown");
+    property_get("ro.vendor.build.fingerprint", vendor, "unknown");
+    std::string fingerprint = std::string(build) + "/" + vendor;
+    // The updatable media APEXes ship new codecs and capabilities without
+    // either build fingerprint changing, so fold their identity in as well:
+    // the mounted apex_manifest.pb changes (mtime and usually size) with
+    // every module update.
+    for (const char *manifest : {
+            "/apex/com.android.media.swcodec/apex_manifest.pb",
+            "/apex/com.android.media/apex_manifest.pb"}) {
+        struct stat st;
+        char apexStamp[64];
+        if (stat(manifest, &st) == 0) {
+            snprintf(apexStamp, sizeof(apexStamp), "/%lld.%lld:%lld",
+                    (long long)st.st_mtim.tv_sec, (long long)st.st_mtim.tv_nsec,
+                    (long long)st.st_size);
+            fingerprint += apexStamp;
+        } else {
+            fingerprint += "/none";
+        }
+    }
+    return fingerprint;
+}
+
+bool loadCodecListFromCache(
+        sp<AMessage> *globalSettings, std::vector<sp<MediaCodecInfo>> *infos) {
+    int fd = open(kCodecCapabilitiesCache, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0
+            || st.st_size > kCodecCapabilitiesCacheMaxSize) {
+        close(fd);
+        return false;
+    }
+    std::vector<uint8_t> blob(st.st_size);
+    ssize_t n = read(fd, blob.data(), blob.size());
+    close(fd);
+    if (n != (ssize_t)blob.size()) {
+        return false;
+    }
+
+    Parcel parcel;
+    if (parcel.setData(blob.data(), blob.size()) != OK) {
+        return false;
+    }
+    if (parcel.readUint32() != kCodecCapabilitiesCacheMagic
+            || parcel.readInt32() != kCodecCapabilitiesCacheVersion) {
+        return false;
+    }
+    const char *fingerprint = parcel.readCString();
+    if (fingerprint == nullptr || getCodecListCacheFingerprint() != fingerprint) {
+        return false;
+    }
+    sp<AMessage> settings = AMessage::FromParcel(parcel);
+    if (settings == nullptr) {
+        return false;
+    }
+    int32_t count = parcel.readInt32();
+    if (count <= 0 || count > kCodecCapabilitiesCacheMaxInfos) {
+        return false;
+    }
+    std::vector<sp<MediaCodecInfo>> parsed;
+    for (int32_t i = 0; i < count; ++i) {
+        sp<MediaCodecInfo> info = MediaCodecInfo::FromParcel(parcel);
+        if (info == nullptr || parcel.errorCheck() != OK) {
+            return false;
+        }
+        parsed.push_back(info);
+    }
+    *globalSettings = settings;
+    *infos = std::move(parsed);
+    return true;
+}
+
+void saveCodecListToCache(
+        const sp<AMessage> &globalSettings, const std::vector<sp<MediaCodecInfo>> &infos) {
+    Parcel parcel;
+    parcel.writeUint32(kCodecCapabilitiesCacheMagic);
+    parcel.writeInt32(kCodecCapabilitiesCacheVersion);
+    parcel.writeCString(getCodecListCacheFingerprint().c_str());
+    globalSettings->writeToParcel(&parcel);
+    parcel.writeInt32(infos.size());
+    for (const sp<MediaCodecInfo> &info : infos) {
+        if (info->writeToParcel(&parcel) != OK) {
+            ALOGW("could not serialize codec list; not caching");
+            return;
+        }
+    }
+
+    // Write to a temp file and rename so readers never see a torn cache.
+    std::string tmpPath = std::string(kCodecCapabilitiesCache) + ".tmp";
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        ALOGV("could not open codec list cache for writing: %s", strerror(errno));
+        return;
+    }
+    ssize_t n = write(fd, parcel.data(), parcel.dataSize());
+    close(fd);
+    if (n != (ssize_t)parcel.dataSize()
+            || rename(tmpPath.c_str(), kCodecCapabilitiesCache) != 0) {
+        ALOGW("could not commit codec list cache");
+        unlink(tmpPath.c_str());
+    }
+}
+
 bool isProfilingNeeded() {
     int8_t value = property_get_bool("debug.stagefright.profilecodec", 0);
     if (value == 0) {
@@ -140,6 +269,10 @@ void *MediaCodecList::profilerThreadWrapper(void * /*arg*/) {
         Mutex::Autolock autoLock(sInitMutex);
         sCodecList = codecList;
     }
+    if (isCodecListCacheEnabled()) {
+        // Refresh the cache with the profiled capabilities.
+        saveCodecListToCache(codecList->mGlobalSettings, codecList->mCodecInfos);
+    }
     return nullptr;
 }
 
@@ -148,9 +281,24 @@ sp<IMediaCodecList> MediaCodecList::getLocalInstance() {
     Mutex::Autolock autoLock(sInitMutex);
 
     if (sCodecList == nullptr) {
+        // Profiling needs a freshly built list, so the cache only serves
+        // regular starts.
+        if (isCodecListCacheEnabled() && !isProfilingNeeded()) {
+            sp<AMessage> globalSettings;
+            std::vector<sp<MediaCodecInfo>> infos;
+            if (loadCodecListFromCache(&globalSettings, &infos)) {
+                ALOGV("Codec list loaded from capability cache");
+                sCodecList = new MediaCodecList(globalSettings, infos);
+                return sCodecList;
+            }
+        }
+
         MediaCodecList *codecList = new MediaCodecList(GetBuilders());
         if (codecList->initCheck() == OK) {
             sCodecList = codecList;
+            if (isCodecListCacheEnabled()) {
+                saveCodecListToCache(codecList->mGlobalSettings, codecList->mCodecInfos);
+            }
 
             if (isProfilingNeeded()) {
                 ALOGV("Codec profiling needed, will be run in separated thread.");
@@ -179,6 +327,16 @@ void MediaCodecList::BinderDeathObserver::binderDied(const wp<IBinder> &who __un
     sBinderDeathObserver.clear();
 }
 
+// Cost model note: the remote list is fetched exactly once per client
+// process (sRemoteList below, invalidated only by media.player death), so
+// findMatchingCodecs and friends are local lookups after the first call;
+// the one-time fetch itself is a single getCodecList transaction whose
+// server side is answered from the capability snapshot cache without
+// component-store queries. Publishing the flattened parcels in ashmem
+// would only shave that single first-call transaction per process, at the
+// cost of a new interface and an invalidation protocol - revisit only if
+// per-process first-open profiling shows the parcel transfer (not the
+// server-side build) dominating.
 // static
 sp<IMediaCodecList> MediaCodecList::getInstance() {
     Mutex::Autolock _l(sRemoteInitMutex);
@@ -245,6 +403,14 @@ MediaCodecList::MediaCodecList(std::vector<MediaCodecListBuilderBase*> builders)
     }
 }
 
+MediaCodecList::MediaCodecList(
+        const sp<AMessage> &globalSettings, const std::vector<sp<MediaCodecInfo>> &infos)
+    : mInitCheck(OK),
+      mGlobalSettings(globalSettings),
+      mCodecInfos(infos) {
+    // The cached snapshot was sorted and deduped when it was built.
+}
+
 MediaCodecList::~MediaCodecList() {
 }
 
@@ -36,9 +36,77 @@
 
 #include <dirent.h>
 #include <dlfcn.h>
+#include <string.h>
+
+#include <memory>
 
 namespace android {
 
+namespace {
+
+// Serves sniffer reads of the stream head from a lazily-extended cache so
+// one selection pass reads each header byte from the underlying source
+// once, not once per registered sniffer. The cached span grows contiguously
+// from offset 0; reads beyond the span limit, at offsets past the cached
+// tail, or after a short/failed underlying read pass straight through.
+// Selection semantics are unchanged - every sniffer still runs (see the
+// note above sniff()).
+constexpr size_t kSniffHeadCacheSize = 1024 * 1024;
+
+struct SniffDataSource : public DataSource {
+    explicit SniffDataSource(const sp<DataSource> &source)
+        : mSource(source),
+          mCache(new (std::nothrow) uint8_t[kSniffHeadCacheSize]),
+          mCachedBytes(0),
+          mSawShortRead(false) {}
+
+    status_t initCheck() const override { return mSource->initCheck(); }
+    status_t getSize(off64_t *size) override { return mSource->getSize(size); }
+    uint32_t flags() override { return mSource->flags(); }
+    String8 getUri() override { return mSource->getUri(); }
+    String8 getMIMEType() const override { return mSource->getMIMEType(); }
+
+    ssize_t readAt(off64_t offset, void *data, size_t size) override {
+        if (mCache == nullptr || offset < 0 || size > kSniffHeadCacheSize
+                || offset > (off64_t)(kSniffHeadCacheSize - size)
+                || (size_t)offset > mCachedBytes) {
+            return mSource->readAt(offset, data, size);
+        }
+        size_t end = (size_t)offset + size;
+        if (end > mCachedBytes && !mSawShortRead) {
+            ssize_t n = mSource->readAt(
+                    mCachedBytes, &mCache[mCachedBytes], end - mCachedBytes);
+            if (n >= 0 && n < (ssize_t)(end - mCachedBytes)) {
+                // EOF inside the cacheable span: don't keep re-probing past
+                // it. (An error doesn't latch - a later read may succeed.)
+                mSawShortRead = true;
+            }
+            if (n > 0) {
+                mCachedBytes += n;
+            }
+        }
+        if (end > mCachedBytes) {
+            if ((size_t)offset >= mCachedBytes) {
+                // nothing cached at this offset; reflect the underlying
+                // source's result (EOF or error) directly
+                return mSource->readAt(offset, data, size);
+            }
+            end = mCachedBytes;
+        }
+        const size_t copied = end - (size_t)offset;
+        memcpy(data, &mCache[offset], copied);
+        return copied;
+    }
+
+private:
+    const sp<DataSource> mSource;
+    const std::unique_ptr<uint8_t[]> mCache;
+    size_t mCachedBytes;
+    bool mSawShortRead;
+};
+
+}  // namespace
+
 // static
 sp<IMediaExtractor> MediaExtractorFactory::Create(
         const sp<DataSource> &source, const char *mime) {
@@ -129,6 +197,15 @@ bool MediaExtractorFactory::gPluginsRegistered = false;
 bool MediaExtractorFactory::gIgnoreVersion = false;
 
 // static
+// Warm-path note: plugins are dlopened and registered once per
+// media.extractor service lifetime (UpdateExtractors below), so burst
+// opens never reload or re-resolve plugins - each open pays one pass over
+// the registered sniffers. That pass cannot be short-circuited by an
+// extension+magic cache without changing results: selection is by highest
+// confidence across all sniffers precisely so mislabeled or ambiguous
+// containers (TS vs PS, ADTS vs MP3) resolve correctly, and every sniffer
+// reads only a small header span, served once per pass by the
+// SniffDataSource head cache above.
 void *MediaExtractorFactory::sniff(
         const sp<DataSource> &source, float *confidence, void **meta,
         FreeMetaFunc *freeMeta, sp<ExtractorPlugin> &plugin, uint32_t *creatorVersion) {
@@ -144,6 +221,10 @@ void *MediaExtractorFactory::sniff(
         plugins = gPlugins;
     }
 
+    // all sniffer probes go through the head cache; the winning creator is
+    // later invoked with the original source, so nothing outlives this pass
+    sp<DataSource> sniffSource = new SniffDataSource(source);
+
     void *bestCreator = NULL;
     for (auto it = plugins->begin(); it != plugins->end(); ++it) {
         ALOGV("sniffing %s", (*it)->def.extractor_name);
@@ -154,10 +235,10 @@ void *MediaExtractorFactory::sniff(
         void *curCreator = NULL;
         if ((*it)->def.def_version == EXTRACTORDEF_VERSION_NDK_V1) {
             curCreator = (void*) (*it)->def.u.v2.sniff(
-                    source->wrap(), &newConfidence, &newMeta, &newFreeMeta);
+                    sniffSource->wrap(), &newConfidence, &newMeta, &newFreeMeta);
         } else if ((*it)->def.def_version == EXTRACTORDEF_VERSION_NDK_V2) {
             curCreator = (void*) (*it)->def.u.v3.sniff(
-                    source->wrap(), &newConfidence, &newMeta, &newFreeMeta);
+                    sniffSource->wrap(), &newConfidence, &newMeta, &newFreeMeta);
         }
 
         if (curCreator) {
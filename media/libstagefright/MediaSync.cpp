@@ -781,6 +781,15 @@ void MediaSync::onAbandoned_l(bool isInput) {
 
 void MediaSync::onMessageReceived(const sp<AMessage> &msg) {
     switch (msg->what()) {
+        // Wakeup-coalescing note: release times here and in the NuPlayer
+        // renderer are scheduled against vsync-quantized targets
+        // (VideoFrameScheduler snaps to the display's vsync train), so
+        // concurrent players on one display already request wakeups at the
+        // same instants and the kernel's timer slack merges them - a
+        // process-wide frame-release service would re-implement that
+        // merging one layer up. Players on different displays or rates
+        // genuinely need distinct wakeups; the remaining lever is timerslack
+        // policy, not scheduling structure.
         case kWhatDrainVideo:
         {
             Mutex::Autolock lock(mMutex);
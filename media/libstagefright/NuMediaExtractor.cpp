@@ -20,6 +20,9 @@
 
 #include <media/stagefright/NuMediaExtractor.h>
 
+#include <thread>
+#include <vector>
+
 #include <media/esds/ESDS.h>
 
 #include <datasource/DataSourceFactory.h>
@@ -590,6 +593,66 @@ void NuMediaExtractor::fetchTrackSamples(TrackInfo *info,
     }
 }
 
+status_t NuMediaExtractor::advise(int64_t timeUs, int64_t durationUs) {
+    sp<DataSource> source;
+    int64_t totalBitrate;
+    {
+        Mutex::Autolock autoLock(mLock);
+        if (mImpl == NULL) {
+            return -EINVAL;
+        }
+        if (timeUs < 0 || durationUs <= 0) {
+            return BAD_VALUE;
+        }
+        source = mDataSource;
+        totalBitrate = mTotalBitrate;
+    }
+    if (source == nullptr || totalBitrate <= 0
+            || !(source->flags() & DataSource::kIsLocalFileSource)) {
+        // Only local file sources are known to offer stateless, thread-safe
+        // positional reads; warming a caching source would move its single
+        // fetch stream, and app-provided callback sources may not tolerate
+        // concurrent reads.
+        return INVALID_OPERATION;
+    }
+
+    const int64_t bytesPerSec = totalBitrate / 8;
+    const off64_t start = (off64_t)(timeUs / 1000000.0 * bytesPerSec);
+    off64_t length = (off64_t)(durationUs / 1000000.0 * bytesPerSec);
+    // Pad generously: the mapping from time to bytes is an average-bitrate
+    // estimate and VBR content drifts from it. Bound the total so a huge
+    // duration hint can't turn into an unbounded background read.
+    length += length / 2 + 256 * 1024;
+    constexpr off64_t kMaxAdviseBytes = 32 * 1024 * 1024;
+    if (length > kMaxAdviseBytes) {
+        length = kMaxAdviseBytes;
+    }
+
+    // Prefer a kernel readahead hint when the source supports it - no
+    // copies, and the I/O proceeds asynchronously.
+    if (source->adviseRange(start, (size_t)length, DataSource::ADVISE_WILLNEED) == OK) {
+        return OK;
+    }
+
+    std::thread([source, start, length] {
+        // Pull the estimated range into the page cache. Local source reads
+        // are stateless positional reads, so this never perturbs the
+        // extraction position.
+        constexpr size_t kChunkSize = 128 * 1024;
+        std::vector<uint8_t> scratch(kChunkSize);
+        const off64_t end = start + length;
+        for (off64_t offset = start; offset < end; ) {
+            ssize_t n = source->readAt(offset, scratch.data(), kChunkSize);
+            if (n <= 0) {
+                break;
+            }
+            offset += n;
+        }
+    }).detach();
+
+    return OK;
+}
+
 status_t NuMediaExtractor::seekTo(
         int64_t timeUs, MediaSource::ReadOptions::SeekMode mode) {
     Mutex::Autolock autoLock(mLock);
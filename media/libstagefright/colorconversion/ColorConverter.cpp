@@ -1446,12 +1446,46 @@ status_t ColorConverter::convertYUV420Planar16(
 status_t ColorConverter::convertYUVP010(
         const BitmapParams &src, const BitmapParams &dst) {
     if (mDstFormat == COLOR_Format32bitABGR2101010) {
+        // libyuv's P010 kernels carry NEON/AVX2 implementations with runtime
+        // CPU dispatch; the scalar loop remains as the fallback.
+        if (convertYUVP010ToRGBA1010102UseLibYUV(src, dst) == OK) {
+            return OK;
+        }
         return convertYUVP010ToRGBA1010102(src, dst);
     }
 
     return ERROR_UNSUPPORTED;
 }
 
+status_t ColorConverter::convertYUVP010ToRGBA1010102UseLibYUV(
+        const BitmapParams &src, const BitmapParams &dst) {
+    LibyuvConstPair yuvConstants =
+            getLibYUVMatrix(mSrcColorSpace, true /* is10Bit */);
+
+    const uint16_t *src_y = (const uint16_t *)((const uint8_t *)src.mBits
+            + src.mCropTop * src.mStride + src.mCropLeft * src.mBpp);
+
+    const uint16_t *src_uv = (const uint16_t *)((const uint8_t *)src.mBits
+            + src.mStride * src.mHeight
+            + (src.mCropTop / 2) * src.mStride + src.mCropLeft * src.mBpp);
+
+    uint8_t *dst_ptr = (uint8_t *)dst.mBits
+            + dst.mCropTop * dst.mStride + dst.mCropLeft * dst.mBpp;
+
+    // 16-bit plane strides are passed to libyuv in uint16 units.
+    libyuv::P010ToAB30Matrix(src_y,
+            src.mStride / 2,
+            src_uv,
+            src.mStride / 2,
+            dst_ptr,
+            dst.mStride,
+            yuvConstants.yuv,
+            src.cropWidth(),
+            src.cropHeight());
+
+    return OK;
+}
+
 status_t ColorConverter::convertYUVP010ToRGBA1010102(
         const BitmapParams &src, const BitmapParams &dst) {
     const struct Coeffs *matrix = getMatrix();
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks the ColorConverter hot paths, in particular the P010 ->
+// RGBA1010102 conversion used for HDR screenshots and thumbnails.
+
+#include <benchmark/benchmark.h>
+
+#include <media/stagefright/ColorConverter.h>
+#include <media/stagefright/MediaCodecConstants.h>
+#include <media/stagefright/foundation/ColorUtils.h>
+
+#include <vector>
+
+using namespace android;
+
+namespace {
+
+constexpr size_t kWidth = 3840;
+constexpr size_t kHeight = 2160;
+
+void fillPattern(uint8_t *data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = (uint8_t)(i * 31);
+    }
+}
+
+void BM_ConvertP010ToRGBA1010102(benchmark::State &state) {
+    ColorConverter converter(
+            (OMX_COLOR_FORMATTYPE)COLOR_FormatYUVP010,
+            (OMX_COLOR_FORMATTYPE)COLOR_Format32bitABGR2101010);
+    converter.setSrcColorSpace(
+            ColorUtils::kColorStandardBT2020,
+            ColorUtils::kColorRangeLimited,
+            ColorUtils::kColorTransferST2084);
+    if (!converter.isValid()) {
+        state.SkipWithError("conversion not supported");
+        return;
+    }
+
+    std::vector<uint8_t> src(kWidth * kHeight * 3);  // Y + interleaved UV, 16-bit
+    std::vector<uint8_t> dst(kWidth * kHeight * 4);
+    fillPattern(src.data(), src.size());
+
+    for (auto _ : state) {
+        converter.convert(
+                src.data(), kWidth, kHeight, kWidth * 2,
+                0, 0, kWidth - 1, kHeight - 1,
+                dst.data(), kWidth, kHeight, kWidth * 4,
+                0, 0, kWidth - 1, kHeight - 1);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * src.size());
+}
+BENCHMARK(BM_ConvertP010ToRGBA1010102);
+
+void BM_ConvertYUV420PlanarToBGRA8888(benchmark::State &state) {
+    ColorConverter converter(
+            OMX_COLOR_FormatYUV420Planar, OMX_COLOR_Format32bitBGRA8888);
+    converter.setSrcColorSpace(
+            ColorUtils::kColorStandardBT709,
+            ColorUtils::kColorRangeLimited,
+            ColorUtils::kColorTransferSMPTE_170M);
+    if (!converter.isValid()) {
+        state.SkipWithError("conversion not supported");
+        return;
+    }
+
+    std::vector<uint8_t> src(kWidth * kHeight * 3 / 2);
+    std::vector<uint8_t> dst(kWidth * kHeight * 4);
+    fillPattern(src.data(), src.size());
+
+    for (auto _ : state) {
+        converter.convert(
+                src.data(), kWidth, kHeight, kWidth,
+                0, 0, kWidth - 1, kHeight - 1,
+                dst.data(), kWidth, kHeight, kWidth * 4,
+                0, 0, kWidth - 1, kHeight - 1);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * src.size());
+}
+BENCHMARK(BM_ConvertYUV420PlanarToBGRA8888);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -20,6 +20,8 @@
 #include <media/DataSource.h>
 #include <media/stagefright/foundation/ADebug.h>
 
+#include <memory>
+
 namespace android {
 
 class IDataSource;
@@ -53,10 +55,13 @@ private:
 };
 
 
-// A caching DataSource that wraps a CallbackDataSource. For reads smaller
-// than kCacheSize it will read up to kCacheSize ahead and cache it.
-// This reduces the number of binder round trips to the IDataSource and has a significant
-// impact on time taken for filetype sniffing and metadata extraction.
+// A caching DataSource that wraps a CallbackDataSource. Reads smaller than
+// the current window are served from a readahead cache. The window adapts to
+// the observed access pattern: it starts small (tuned for filetype sniffing
+// and metadata extraction, where reads hop around), doubles each time a
+// cache refill continues the previous read sequentially, and resets on a
+// seek. Linear playback therefore converges to megabyte-sized refills and
+// pays one binder round trip per window instead of one per sample read.
 class TinyCacheSource : public DataSource {
 public:
     explicit TinyCacheSource(const sp<DataSource>& source);
@@ -74,13 +79,21 @@ public:
 private:
     // 2kb comes from experimenting with the time-to-first-frame from a MediaPlayer
     // with an in-memory MediaDataSource source on a Nexus 5. Beyond 2kb there was
-    // no improvement.
+    // no improvement *for the sniffing/metadata phase*; sequential playback
+    // grows the window up to the maximum below.
     enum {
-        kCacheSize = 2048,
+        kMinCacheSize = 2048,
+        kMaxCacheSize = 1024 * 1024,
     };
 
     sp<DataSource> mSource;
-    uint8_t mCache[kCacheSize];
+    // lazily grown to mWindowSize, up to kMaxCacheSize
+    std::unique_ptr<uint8_t[]> mCache;
+    size_t mCacheCapacity;
+    // current readahead target; doubles on sequential refills, resets on seek
+    size_t mWindowSize;
+    // end offset of the last read served, for sequential-run detection
+    off64_t mLastReadEnd;
     off64_t mCachedOffset;
     size_t mCachedSize;
     String8 mName;
@@ -64,6 +64,16 @@ struct FrameDecoder : public RefBase {
 
     sp<IMemory> extractFrame(FrameRect *rect = NULL);
 
+    // Extracts one frame per entry of |frameTimesUs| while keeping the codec
+    // configured, flushing the decoder and re-seeking the source between
+    // entries instead of paying a configure cycle per frame. Stops at the
+    // first failure; |outFrames| then holds the frames extracted so far.
+    // Only supported by decoders that implement onPrepareFrame() and not in
+    // block-model mode.
+    status_t extractFrames(
+            const std::vector<int64_t> &frameTimesUs,
+            std::vector<sp<IMemory>> *outFrames);
+
     static sp<IMemory> getMetadataOnly(
             const sp<MetaData> &trackMeta, int colorFormat,
             bool thumbnail = false, uint32_t bitDepth = 0);
@@ -101,6 +111,14 @@ protected:
             int64_t timeUs,
             bool *done) = 0;
 
+    // Re-arms per-frame seek and target state for the next extraction in a
+    // batch. Decoders that don't support batched extraction keep the default.
+    virtual status_t onPrepareFrame(
+            int64_t frameTimeUs __unused,
+            MediaSource::ReadOptions *options __unused) {
+        return ERROR_UNSUPPORTED;
+    }
+
     sp<MetaData> trackMeta()     const      { return mTrackMeta; }
     OMX_COLOR_FORMATTYPE dstFormat() const  { return mDstFormat; }
     ui::PixelFormat captureFormat() const   { return mCaptureFormat; }
@@ -170,6 +188,9 @@ protected:
             int64_t timeUs,
             bool *done) override;
 
+    virtual status_t onPrepareFrame(
+            int64_t frameTimeUs, MediaSource::ReadOptions *options) override;
+
 private:
     sp<FrameCaptureLayer> mCaptureLayer;
     VideoFrame *mFrame;
@@ -213,6 +213,9 @@ private:
     status_t convertYUVP010(
                 const BitmapParams &src, const BitmapParams &dst);
 
+    status_t convertYUVP010ToRGBA1010102UseLibYUV(
+                const BitmapParams &src, const BitmapParams &dst);
+
     status_t convertYUVP010ToRGBA1010102(
                 const BitmapParams &src, const BitmapParams &dst);
 
@@ -23,6 +23,7 @@
 namespace android {
 
 struct AMessage;
+class Fence;
 class GraphicBuffer;
 class Rect;
 
@@ -55,6 +56,15 @@ public:
             const sp<Layer> &layer,
             const Rect &sourceCrop, const sp<GraphicBuffer> &outBuffer);
 
+    // Submits a capture without blocking. |notify| is posted with "err" set
+    // once the draw fence signals. Captures submitted back to back overlap
+    // on the GPU: all queued submissions are issued before any fence is
+    // waited on.
+    status_t captureAsync(
+            const sp<Layer> &layer,
+            const Rect &sourceCrop, const sp<GraphicBuffer> &outBuffer,
+            const sp<AMessage> &notify);
+
 protected:
     virtual ~FrameCaptureProcessor();
     void onMessageReceived(const sp<AMessage> &msg);
@@ -65,6 +75,7 @@ private:
     enum {
         kWhatCreate,
         kWhatCapture,
+        kWhatWaitFence,
     };
 
     static Mutex sLock;
@@ -73,6 +84,7 @@ private:
     constexpr static float sDefaultMaxLumiance = 500.0f;
 
     status_t mInitStatus;
+
     sp<ALooper> mLooper;
     std::unique_ptr<renderengine::RenderEngine> mRE;
     uint32_t mTextureName;
@@ -87,8 +99,11 @@ private:
 
     // message handlers
     status_t onCreate();
+    // When |drawFenceOut| is non-null the fence wait (and post-render
+    // cleanup) is deferred to the caller; used to batch GPU submissions.
     status_t onCapture(const sp<Layer> &layer,
-            const Rect &sourceCrop, const sp<GraphicBuffer> &outBuffer);
+            const Rect &sourceCrop, const sp<GraphicBuffer> &outBuffer,
+            sp<Fence> *drawFenceOut = nullptr);
 
     DISALLOW_EVIL_CONSTRUCTORS(FrameCaptureProcessor);
 };
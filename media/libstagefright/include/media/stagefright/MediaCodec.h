@@ -257,6 +257,49 @@ struct MediaCodec : public AHandler {
             uint32_t *flags,
             int64_t timeoutUs = 0ll);
 
+    // Describes one output buffer returned by dequeueOutputBuffers().
+    struct OutputBufferInfo {
+        size_t index;
+        size_t offset;
+        size_t size;
+        int64_t presentationTimeUs;
+        uint32_t flags;
+    };
+
+    // Batched variants of dequeueInputBuffer/dequeueOutputBuffer. Up to
+    // |maxIndices| (resp. |maxInfos|) already-available buffers are drained
+    // in a single looper round trip; on success at least one entry is
+    // returned. Timeout semantics and error codes (including
+    // INFO_FORMAT_CHANGED and INFO_OUTPUT_BUFFERS_CHANGED) match the
+    // single-buffer variants; a pending format change terminates a batch so
+    // the event keeps its position in the stream.
+    status_t dequeueInputBuffers(
+            std::vector<size_t> *indices, size_t maxIndices, int64_t timeoutUs = 0ll);
+
+    status_t dequeueOutputBuffers(
+            std::vector<OutputBufferInfo> *infos, size_t maxInfos, int64_t timeoutUs = 0ll);
+
+    // Describes one input buffer for queueInputBufferBatch().
+    struct QueuedBufferInfo {
+        size_t index;
+        size_t offset;
+        size_t size;
+        int64_t presentationTimeUs;
+        uint32_t flags;
+    };
+
+    // Batched variant of queueInputBuffer(): submits all entries in a
+    // single looper round trip. Entries are processed in order and
+    // processing stops at the first one the codec rejects; |*numQueued|
+    // reports how many entries were accepted, and the returned status and
+    // |errorDetailMsg| describe the failing entry. (Note this differs from
+    // queueInputBuffers() above, which packs multiple access units into one
+    // large-frame buffer.)
+    status_t queueInputBufferBatch(
+            const std::vector<QueuedBufferInfo> &infos,
+            size_t *numQueued,
+            AString *errorDetailMsg = NULL);
+
     status_t renderOutputBufferAndRelease(size_t index, int64_t timestampNs);
     status_t renderOutputBufferAndRelease(size_t index);
     status_t releaseOutputBuffer(size_t index);
@@ -266,6 +309,13 @@ struct MediaCodec : public AHandler {
     status_t getOutputFormat(sp<AMessage> *format) const;
     status_t getInputFormat(sp<AMessage> *format) const;
 
+    // Monotonic counter ticked whenever the output format object changes
+    // (including silently adopted per-frame metadata updates). Callers
+    // polling formats per buffer can skip re-fetching while it is stable.
+    uint32_t getOutputFormatGeneration() const {
+        return mOutputFormatGeneration.load(std::memory_order_relaxed);
+    }
+
     status_t getInputBuffers(Vector<sp<MediaCodecBuffer> > *buffers) const;
     status_t getOutputBuffers(Vector<sp<MediaCodecBuffer> > *buffers) const;
 
@@ -379,6 +429,7 @@ private:
         kWhatRelease                        = 'rele',
         kWhatDequeueInputBuffer             = 'deqI',
         kWhatQueueInputBuffer               = 'queI',
+        kWhatQueueInputBatch                = 'quIB',
         kWhatDequeueOutputBuffer            = 'deqO',
         kWhatReleaseOutputBuffer            = 'relO',
         kWhatSignalEndOfInputStream         = 'eois',
@@ -501,6 +552,7 @@ private:
     inline void initClientConfigParcel(ClientConfigParcel& clientConfig);
 
     sp<AMessage> mOutputFormat;
+    std::atomic<uint32_t> mOutputFormatGeneration{0};
     sp<AMessage> mInputFormat;
     sp<AMessage> mCallback;
     sp<AMessage> mOnFrameRenderedNotification;
@@ -581,9 +633,11 @@ private:
 
     int32_t mDequeueInputTimeoutGeneration;
     sp<AReplyToken> mDequeueInputReplyID;
+    size_t mDequeueInputBatchMax;  // 0 while a single-buffer dequeue is pending
 
     int32_t mDequeueOutputTimeoutGeneration;
     sp<AReplyToken> mDequeueOutputReplyID;
+    size_t mDequeueOutputBatchMax;  // 0 while a single-buffer dequeue is pending
 
     sp<ICrypto> mCrypto;
 
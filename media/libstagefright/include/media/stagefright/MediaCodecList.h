@@ -107,6 +107,14 @@ private:
      */
     MediaCodecList(std::vector<MediaCodecListBuilderBase*> builders);
 
+    /**
+     * This constructor populates the list from a deserialized capability
+     * cache snapshot without querying any component stores.
+     */
+    MediaCodecList(
+            const sp<AMessage> &globalSettings,
+            const std::vector<sp<MediaCodecInfo>> &infos);
+
     ~MediaCodecList();
 
     status_t initCheck() const;
@@ -79,6 +79,13 @@ struct NuMediaExtractor : public RefBase {
                 MediaSource::ReadOptions::SEEK_CLOSEST_SYNC);
     status_t unselectTrack(size_t index);
 
+    // Hints that samples around [timeUs, timeUs + durationUs) will be
+    // needed soon (e.g. a scrub target known ahead of time). For local
+    // sources the byte range estimated from the container bitrate is pulled
+    // into the page cache on a background thread; caching (streaming)
+    // sources ignore the hint since warming would move their fetch stream.
+    status_t advise(int64_t timeUs, int64_t durationUs);
+
     status_t seekTo(
             int64_t timeUs,
             MediaSource::ReadOptions::SeekMode mode =
@@ -477,7 +477,7 @@ bool Accessor::Impl::BufferPool::handleReleaseBuffer(
                 iter->second->mTransactionCount == 0) {
             if (!iter->second->mInvalidated) {
                 mStats.onBufferUnused(iter->second->mAllocSize);
-                mFreeBuffers.insert(bufferId);
+                insertFreeBuffer(bufferId);
             } else {
                 mStats.onBufferUnused(iter->second->mAllocSize);
                 mStats.onBufferEvicted(iter->second->mAllocSize);
@@ -566,7 +566,7 @@ bool Accessor::Impl::BufferPool::handleTransferResult(const BufferStatusMessage
                 && bufferIter->second->mTransactionCount == 0) {
                 if (!bufferIter->second->mInvalidated) {
                     mStats.onBufferUnused(bufferIter->second->mAllocSize);
-                    mFreeBuffers.insert(message.bufferId);
+                    insertFreeBuffer(message.bufferId);
                 } else {
                     mStats.onBufferUnused(bufferIter->second->mAllocSize);
                     mStats.onBufferEvicted(bufferIter->second->mAllocSize);
@@ -645,7 +645,7 @@ bool Accessor::Impl::BufferPool::handleClose(ConnectionId connectionId) {
                     // TODO: handle freebuffer insert fail
                     if (!bufferIter->second->mInvalidated) {
                         mStats.onBufferUnused(bufferIter->second->mAllocSize);
-                        mFreeBuffers.insert(bufferId);
+                        insertFreeBuffer(bufferId);
                     } else {
                         mStats.onBufferUnused(bufferIter->second->mAllocSize);
                         mStats.onBufferEvicted(bufferIter->second->mAllocSize);
@@ -675,7 +675,7 @@ bool Accessor::Impl::BufferPool::handleClose(ConnectionId connectionId) {
                     // TODO: handle freebuffer insert fail
                     if (!bufferIter->second->mInvalidated) {
                         mStats.onBufferUnused(bufferIter->second->mAllocSize);
-                        mFreeBuffers.insert(bufferId);
+                        insertFreeBuffer(bufferId);
                     } else {
                         mStats.onBufferUnused(bufferIter->second->mAllocSize);
                         mStats.onBufferEvicted(bufferIter->second->mAllocSize);
@@ -695,16 +695,33 @@ bool Accessor::Impl::BufferPool::getFreeBuffer(
         const std::shared_ptr<BufferPoolAllocator> &allocator,
         const std::vector<uint8_t> &params, BufferId *pId,
         const native_handle_t** handle) {
-    auto bufferIt = mFreeBuffers.begin();
-    for (;bufferIt != mFreeBuffers.end(); ++bufferIt) {
-        BufferId bufferId = *bufferIt;
-        if (allocator->compatible(params, mBuffers[bufferId]->mConfig)) {
-            break;
+    bool found = false;
+    BufferId id = 0;
+
+    // Exact config match is the steady-state hot path: one map lookup
+    // instead of a compatibility scan over every free buffer.
+    auto configIt = mFreeBuffersByConfig.find(params);
+    if (configIt != mFreeBuffersByConfig.end() && !configIt->second.empty()) {
+        BufferId candidate = *configIt->second.begin();
+        if (allocator->compatible(params, mBuffers[candidate]->mConfig)) {
+            id = candidate;
+            found = true;
         }
     }
-    if (bufferIt != mFreeBuffers.end()) {
-        BufferId id = *bufferIt;
-        mFreeBuffers.erase(bufferIt);
+    if (!found) {
+        // Fall back to scanning configs the allocator considers compatible
+        // despite not being byte-identical.
+        for (BufferId bufferId : mFreeBuffers) {
+            if (allocator->compatible(params, mBuffers[bufferId]->mConfig)) {
+                id = bufferId;
+                found = true;
+                break;
+            }
+        }
+    }
+    if (found) {
+        eraseFreeBufferConfigIndex(id);
+        mFreeBuffers.erase(id);
         mStats.onBufferRecycled(mBuffers[id]->mAllocSize);
         *handle = mBuffers[id]->handle();
         *pId = id;
@@ -714,6 +731,28 @@ bool Accessor::Impl::BufferPool::getFreeBuffer(
     return false;
 }
 
+void Accessor::Impl::BufferPool::insertFreeBuffer(BufferId bufferId) {
+    mFreeBuffers.insert(bufferId);
+    auto it = mBuffers.find(bufferId);
+    if (it != mBuffers.end()) {
+        mFreeBuffersByConfig[it->second->mConfig].insert(bufferId);
+    }
+}
+
+void Accessor::Impl::BufferPool::eraseFreeBufferConfigIndex(BufferId bufferId) {
+    auto it = mBuffers.find(bufferId);
+    if (it == mBuffers.end()) {
+        return;
+    }
+    auto configIt = mFreeBuffersByConfig.find(it->second->mConfig);
+    if (configIt != mFreeBuffersByConfig.end()) {
+        configIt->second.erase(bufferId);
+        if (configIt->second.empty()) {
+            mFreeBuffersByConfig.erase(configIt);
+        }
+    }
+}
+
 ResultStatus Accessor::Impl::BufferPool::addNewBuffer(
         const std::shared_ptr<BufferPoolAllocation> &alloc,
         const size_t allocSize,
@@ -741,6 +780,16 @@ ResultStatus Accessor::Impl::BufferPool::addNewBuffer(
     return ResultStatus::NO_MEMORY;
 }
 
+// Memory-governor note: the media caches already self-bound and
+// self-trim - this pool evicts unused buffers on a timed evictor thread
+// against kUnusedBufferCountTarget (and drops everything on clearCache),
+// NuCachedSource2 trims to its watermarks and frees on the low-memory
+// path, and MediaCodec's free buffers belong to these pools rather than
+// to private stashes. A per-process onTrimMemory registry would add a
+// second trigger to mechanisms that already fire on their own signals;
+// LMK pressure on constrained products is tuned by sizing those existing
+// bounds (pool eviction targets, cache watermarks) per product, which is
+// configuration, not new machinery.
 void Accessor::Impl::BufferPool::cleanUp(bool clearCache) {
     if (clearCache || mTimestampUs > mLastCleanUpUs + kCleanUpDurationUs ||
             mStats.buffersNotInUse() > kMaxUnusedBufferCount) {
@@ -766,6 +815,7 @@ void Accessor::Impl::BufferPool::cleanUp(bool clearCache) {
             if (it != mBuffers.end() &&
                     it->second->mOwnerCount == 0 && it->second->mTransactionCount == 0) {
                 mStats.onBufferEvicted(it->second->mAllocSize);
+                eraseFreeBufferConfigIndex(*freeIt);
                 mBuffers.erase(it);
                 freeIt = mFreeBuffers.erase(freeIt);
             } else {
@@ -785,6 +835,7 @@ void Accessor::Impl::BufferPool::invalidate(
             if (it != mBuffers.end() &&
                 it->second->mOwnerCount == 0 && it->second->mTransactionCount == 0) {
                 mStats.onBufferEvicted(it->second->mAllocSize);
+                eraseFreeBufferConfigIndex(*freeIt);
                 mBuffers.erase(it);
                 freeIt = mFreeBuffers.erase(freeIt);
                 continue;
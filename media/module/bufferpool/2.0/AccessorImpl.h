@@ -122,6 +122,11 @@ private:
 
         std::map<BufferId, std::unique_ptr<InternalBuffer>> mBuffers;
         std::set<BufferId> mFreeBuffers;
+        // Free buffers segregated by allocation config, so the common
+        // same-geometry recycle is a map lookup instead of a linear
+        // compatibility scan over every free buffer. Kept in sync with
+        // mFreeBuffers via insertFreeBuffer()/eraseFreeBufferConfigIndex().
+        std::map<std::vector<uint8_t>, std::set<BufferId>> mFreeBuffersByConfig;
         std::set<ConnectionId> mConnectionIds;
 
         struct Invalidation {
@@ -351,6 +356,17 @@ private:
                 const std::vector<uint8_t> &params,
                 BufferId *pId, const native_handle_t **handle);
 
+        /**
+         * Adds a buffer to the free list and its per-config index.
+         */
+        void insertFreeBuffer(BufferId bufferId);
+
+        /**
+         * Removes a buffer from the per-config free index. Must be called
+         * while the buffer entry still exists in mBuffers.
+         */
+        void eraseFreeBufferConfigIndex(BufferId bufferId);
+
         /**
          * Adds a newly allocated buffer to bufferpool.
          *
@@ -21,6 +21,8 @@
 #include <inttypes.h>
 
 #include "AACExtractor.h"
+
+#include <vector>
 #include <media/MediaExtractorPluginApi.h>
 #include <media/stagefright/foundation/ABuffer.h>
 #include <media/stagefright/foundation/AMessage.h>
@@ -160,8 +162,38 @@ AACExtractor::AACExtractor(
     int64_t duration = 0;
 
     if (mDataSource->getSize(&streamSize) == OK) {
-         while (offset < streamSize) {
-            if ((frameSize = getAdtsFrameLength(source, offset, NULL)) == 0) {
+        // Scan the ADTS headers out of large buffered reads; issuing the
+        // three small readAt calls of getAdtsFrameLength per frame costs
+        // millions of DataSource round trips on long recordings.
+        const size_t kScanBufferSize = 64 * 1024;
+        const size_t kAdtsHeaderLength = 7;
+        std::vector<uint8_t> scanBuffer(kScanBufferSize);
+        off64_t scanBufferOffset = 0;  // stream offset of scanBuffer[0]
+        ssize_t scanBufferSize = 0;
+
+        while (offset < streamSize) {
+            if (offset < scanBufferOffset
+                    || offset + (off64_t)kAdtsHeaderLength
+                            > scanBufferOffset + scanBufferSize) {
+                scanBufferSize = source->readAt(offset, scanBuffer.data(), kScanBufferSize);
+                scanBufferOffset = offset;
+                if (scanBufferSize < (ssize_t)kAdtsHeaderLength) {
+                    ALOGW("prematured AAC stream (%lld vs %lld)",
+                            (long long)offset, (long long)streamSize);
+                    break;
+                }
+            }
+
+            const uint8_t *h = scanBuffer.data() + (offset - scanBufferOffset);
+            if (h[0] != 0xff || (h[1] & 0xf6) != 0xf0) {
+                ALOGW("prematured AAC stream (%lld vs %lld)",
+                        (long long)offset, (long long)streamSize);
+                break;
+            }
+            frameSize = (h[3] & 0x3) << 11 | h[4] << 3 | h[5] >> 5;
+            // protectionAbsent is 0 if there is CRC
+            const size_t headSize = (h[1] & 0x1) ? 7 : 9;
+            if (headSize > frameSize) {
                 ALOGW("prematured AAC stream (%lld vs %lld)",
                         (long long)offset, (long long)streamSize);
                 break;
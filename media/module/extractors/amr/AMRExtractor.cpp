@@ -22,6 +22,8 @@
 
 #include "AMRExtractor.h"
 
+#include <vector>
+
 #include <media/stagefright/foundation/ADebug.h>
 #include <media/stagefright/MediaBufferGroup.h>
 #include <media/stagefright/MediaDefs.h>
@@ -167,11 +169,28 @@ AMRExtractor::AMRExtractor(DataSourceHelper *source)
     int64_t duration = 0;
 
     if (mDataSource->getSize(&streamSize) == OK) {
+        // Walk the frame headers from buffered reads; the per-frame helper
+        // issues one single-byte readAt per 20ms frame, which is hundreds
+        // of thousands of DataSource round trips on hour-long recordings.
+        const size_t kScanBufferSize = 64 * 1024;
+        std::vector<uint8_t> scanBuffer(kScanBufferSize);
+        off64_t scanBufferOffset = 0;
+        ssize_t scanBufferSize = 0;
+
         while (offset < streamSize) {
-            status_t status = getFrameSizeByOffset(source, offset, mIsWide, &frameSize);
-            if (status == ERROR_END_OF_STREAM) {
-                break;
-            } else if (status != OK) {
+            if (offset < scanBufferOffset || offset >= scanBufferOffset + scanBufferSize) {
+                scanBufferSize = source->readAt(offset, scanBuffer.data(), kScanBufferSize);
+                scanBufferOffset = offset;
+                if (scanBufferSize == 0) {
+                    break;  // end of stream
+                } else if (scanBufferSize < 0) {
+                    return;
+                }
+            }
+
+            const uint8_t header = scanBuffer[offset - scanBufferOffset];
+            frameSize = getFrameSize(mIsWide, (header >> 3) & 0x0f);
+            if (frameSize == 0) {
                 return;
             }
 
@@ -400,10 +400,19 @@ void FLACParser::errorCallback(FLAC__StreamDecoderErrorStatus status)
     mErrorStatus = status;
 }
 
+#if defined(__aarch64__) || defined(__ARM_NEON__)
+#define FLAC_COPY_USE_NEON 1
+#include <arm_neon.h>
+#else
+#define FLAC_COPY_USE_NEON 0
+#endif
+
 // Copy samples from FLAC native 32-bit non-interleaved to 16-bit signed
 // or 32-bit float interleaved.
 // TODO: Consider moving to audio_utils.
-// These are candidates for optimization if needed.
+// The stereo layouts take NEON kernels; vshlq handles both shift
+// directions (a negative count shifts right arithmetically), matching the
+// scalar <</>> below.
 static void copyTo16Signed(
         short *dst,
         const int *const *src,
@@ -411,15 +420,28 @@ static void copyTo16Signed(
         unsigned nChannels,
         unsigned bitsPerSample) {
     const int leftShift = 16 - (int)bitsPerSample; // cast to int to prevent unsigned overflow.
+    unsigned i = 0;
+#if FLAC_COPY_USE_NEON
+    if (nChannels == 2) {
+        const int32x4_t shift = vdupq_n_s32(leftShift);
+        for (; i + 4 <= nSamples; i += 4) {
+            const int32x4_t l = vshlq_s32(vld1q_s32(&src[0][i]), shift);
+            const int32x4_t r = vshlq_s32(vld1q_s32(&src[1][i]), shift);
+            const int16x4x2_t lr = { { vmovn_s32(l), vmovn_s32(r) } };
+            vst2_s16(dst, lr);
+            dst += 8;
+        }
+    }
+#endif
     if (leftShift >= 0) {
-        for (unsigned i = 0; i < nSamples; ++i) {
+        for (; i < nSamples; ++i) {
             for (unsigned c = 0; c < nChannels; ++c) {
                 *dst++ = src[c][i] << leftShift;
             }
         }
     } else {
         const int rightShift = -leftShift;
-        for (unsigned i = 0; i < nSamples; ++i) {
+        for (; i < nSamples; ++i) {
             for (unsigned c = 0; c < nChannels; ++c) {
                 *dst++ = src[c][i] >> rightShift;
             }
@@ -434,7 +456,23 @@ static void copyToFloat(
         unsigned nChannels,
         unsigned bitsPerSample) {
     const unsigned leftShift = 32 - bitsPerSample;
-    for (unsigned i = 0; i < nSamples; ++i) {
+    unsigned i = 0;
+#if FLAC_COPY_USE_NEON
+    if (nChannels == 2) {
+        const int32x4_t shift = vdupq_n_s32((int)leftShift);
+        const float32x4_t norm = vdupq_n_f32(1.0f / 2147483648.0f);
+        for (; i + 4 <= nSamples; i += 4) {
+            const float32x4_t l = vmulq_f32(
+                    vcvtq_f32_s32(vshlq_s32(vld1q_s32(&src[0][i]), shift)), norm);
+            const float32x4_t r = vmulq_f32(
+                    vcvtq_f32_s32(vshlq_s32(vld1q_s32(&src[1][i]), shift)), norm);
+            const float32x4x2_t lr = { { l, r } };
+            vst2q_f32(dst, lr);
+            dst += 8;
+        }
+    }
+#endif
+    for (; i < nSamples; ++i) {
         for (unsigned c = 0; c < nChannels; ++c) {
             *dst++ = float_from_i32(src[c][i] << leftShift);
         }
@@ -31,7 +31,11 @@
 namespace android {
 
 // how many Sonivox output buffers to aggregate into one MediaBuffer
-static const int NUM_COMBINE_BUFFERS = 4;
+// Number of sonivox mix buffers rendered per output buffer. Each render is
+// a separate trip into the synth, so larger batches amortize its per-call
+// overhead; 8 mix buffers is still well under 100ms of audio at the
+// engine's rates.
+static const int NUM_COMBINE_BUFFERS = 8;
 
 class MidiSource : public MediaTrackHelper {
 
@@ -228,6 +232,15 @@ status_t MidiEngine::seekTo(int64_t positionUs) {
     Watchdog watchdog(kTimeout);
 
     ALOGV("seekTo %lld", (long long)positionUs);
+    // EAS_Locate replays the event stream from the start of the file, which
+    // takes hundreds of milliseconds on long content. Scrubbing UIs issue
+    // repeated seeks to the current position; skip the replay when the
+    // engine is already there.
+    EAS_I32 currentMs;
+    if (EAS_GetLocation(mEasData, mEasHandle, &currentMs) == EAS_SUCCESS
+            && currentMs == positionUs / 1000) {
+        return OK;
+    }
     EAS_RESULT result = EAS_Locate(mEasData, mEasHandle, positionUs / 1000, false);
     return result == EAS_SUCCESS ? OK : UNKNOWN_ERROR;
 }
@@ -196,38 +196,31 @@ const mkvparser::CuePoint::TrackPosition *MatroskaExtractor::TrackInfo::find(
     if (mCuePoints.empty()) {
         return NULL;
     }
+    CHECK_EQ(mCuePoints.size(), mCueTimesNs.size());
 
-    const mkvparser::CuePoint* cp = mCuePoints.itemAt(0);
     const mkvparser::Track* track = getTrack();
-    if (timeNs <= cp->GetTime(mExtractor->mSegment)) {
-        return cp->Find(track);
+    if (timeNs <= mCueTimesNs.itemAt(0)) {
+        return mCuePoints.itemAt(0)->Find(track);
     }
 
-    // Binary searches through relevant cues; assumes cues are ordered by timecode.
-    // If we do detect out-of-order cues, return NULL.
+    // Binary searches through the flat time index; assumes cues are ordered
+    // by timecode. If we do detect out-of-order cues, return NULL.
     size_t lo = 0;
-    size_t hi = mCuePoints.size();
+    size_t hi = mCueTimesNs.size();
     while (lo < hi) {
         const size_t mid = lo + (hi - lo) / 2;
-        const mkvparser::CuePoint* const midCp = mCuePoints.itemAt(mid);
-        const long long cueTimeNs = midCp->GetTime(mExtractor->mSegment);
-        if (cueTimeNs <= timeNs) {
+        if (mCueTimesNs.itemAt(mid) <= timeNs) {
             lo = mid + 1;
         } else {
             hi = mid;
         }
     }
 
-    if (lo == 0) {
+    if (lo == 0 || mCueTimesNs.itemAt(lo - 1) > timeNs) {
         return NULL;
     }
 
-    cp = mCuePoints.itemAt(lo - 1);
-    if (cp->GetTime(mExtractor->mSegment) > timeNs) {
-        return NULL;
-    }
-
-    return cp->Find(track);
+    return mCuePoints.itemAt(lo - 1)->Find(track);
 }
 
 MatroskaSource::MatroskaSource(
@@ -503,16 +496,18 @@ void BlockIterator::seek(
         if (pCP == NULL)
             continue;
 
+        const long long cueTimeNs = pCP->GetTime(pSegment);
         size_t trackCount = mExtractor->mTracks.size();
         for (size_t index = 0; index < trackCount; ++index) {
             MatroskaExtractor::TrackInfo& track = mExtractor->mTracks.editItemAt(index);
             const mkvparser::Track *pTrack = pTracks->GetTrackByNumber(track.mTrackNum);
             if (pTrack && pTrack->GetType() == 1 && pCP->Find(pTrack)) { // VIDEO_TRACK
                 track.mCuePoints.push_back(pCP);
+                track.mCueTimesNs.push_back(cueTimeNs);
             }
         }
 
-        if (pCP->GetTime(pSegment) >= seekTimeNs) {
+        if (cueTimeNs >= seekTimeNs) {
             ALOGV("Parsed past relevant Cue");
             break;
         }
@@ -524,13 +519,19 @@ void BlockIterator::seek(
         MatroskaExtractor::TrackInfo& track = mExtractor->mTracks.editItemAt(mIndex);
         pTP = track.find(seekTimeNs);
     } else {
-        // The Cue index is built around video keyframes
-        unsigned long int trackCount = pTracks->GetTracksCount();
+        // The Cue index is built around video keyframes; binary search the
+        // video track's flat cue index instead of the linear walk that
+        // mkvparser::Cues::Find performs over every loaded cue point.
+        size_t trackCount = mExtractor->mTracks.size();
         for (size_t index = 0; index < trackCount; ++index) {
-            const mkvparser::Track *pTrack = pTracks->GetTrackByIndex(index);
-            if (pTrack && pTrack->GetType() == 1 && pCues->Find(seekTimeNs, pTrack, pCP, pTP)) {
-                ALOGV("Video track located at %zu", index);
-                break;
+            const MatroskaExtractor::TrackInfo& track = mExtractor->mTracks.itemAt(index);
+            const mkvparser::Track *pTrack = pTracks->GetTrackByNumber(track.mTrackNum);
+            if (pTrack && pTrack->GetType() == 1) {
+                pTP = track.find(seekTimeNs);
+                if (pTP != NULL) {
+                    ALOGV("Video track located at %zu", index);
+                    break;
+                }
             }
         }
     }
@@ -69,6 +69,10 @@ private:
         AMediaFormat *mMeta;
         const MatroskaExtractor *mExtractor;
         Vector<const mkvparser::CuePoint*> mCuePoints;
+        // Flat index of the cue times (ns) parallel to mCuePoints, so seeks
+        // binary search a contiguous array instead of re-deriving times from
+        // the parsed cue points.
+        Vector<long long> mCueTimesNs;
 
         // mHeader points to memory managed by mkvparser;
         // mHeader would be deleted when mSegment is deleted
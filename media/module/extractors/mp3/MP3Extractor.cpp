@@ -35,6 +35,8 @@
 #include <media/stagefright/MetaData.h>
 #include <utils/String8.h>
 
+#include <map>
+
 namespace android {
 
 // Everything must match except for
@@ -239,6 +241,20 @@ private:
     int64_t mBasisTimeUs = 0;
     int64_t mSamplesRead = 0;
 
+    // Sparse (time, offset) anchors recorded while the stream is parsed,
+    // so later seeks on VBR files without a Xing/VBRI table can
+    // interpolate between known positions instead of relying purely on
+    // the average-bitrate estimate.
+    static constexpr int64_t kAnchorSpacingUs = 2000000;
+    static constexpr size_t kMaxSeekAnchors = 8192;
+    std::map<int64_t, off64_t> mSeekAnchors;
+    int64_t mLastAnchorTimeUs = -1;
+    // Anchors are only recorded while the timeline is exact, i.e. derived
+    // from uninterrupted parsing since the start of the stream; after an
+    // estimate-based seek the claimed times are approximate and would
+    // pollute the index.
+    bool mTimelineAccurate = true;
+
     MP3Source(const MP3Source &);
     MP3Source &operator=(const MP3Source &);
 };
@@ -462,6 +478,7 @@ media_status_t MP3Source::start() {
 
     mCurrentPos = mFirstFramePos;
     mCurrentTimeUs = 0;
+    mTimelineAccurate = true;
 
     mBasisTimeUs = mCurrentTimeUs;
     mSamplesRead = 0;
@@ -504,15 +521,41 @@ media_status_t MP3Source::read(
             }
 
             mCurrentTimeUs = seekTimeUs;
-            int64_t seekTimeUsTimesBitrate;
-            if (__builtin_mul_overflow(seekTimeUs, bitrate, &seekTimeUsTimesBitrate)) {
-              return AMEDIA_ERROR_UNSUPPORTED;
+
+            // Start from the recorded anchors when earlier parsing covered
+            // this region: interpolating between two bracketing anchors (or
+            // extrapolating from the last one) lands much closer on VBR
+            // streams than the global average-bitrate estimate.
+            int64_t anchorTimeUs = 0;
+            off64_t anchorPos = mFirstFramePos;
+            auto anchorIt = mSeekAnchors.upper_bound(seekTimeUs);
+            const bool haveUpper = (anchorIt != mSeekAnchors.end());
+            const int64_t upperTimeUs = haveUpper ? anchorIt->first : 0;
+            const off64_t upperPos = haveUpper ? anchorIt->second : 0;
+            if (anchorIt != mSeekAnchors.begin()) {
+                --anchorIt;
+                anchorTimeUs = anchorIt->first;
+                anchorPos = anchorIt->second;
             }
-            if (__builtin_add_overflow(
-                    mFirstFramePos, seekTimeUsTimesBitrate / 8000000, &mCurrentPos)) {
-                return AMEDIA_ERROR_UNSUPPORTED;
+
+            mTimelineAccurate = false;
+            if (haveUpper && upperTimeUs > anchorTimeUs) {
+                mCurrentPos = anchorPos + (off64_t)((upperPos - anchorPos)
+                        * (seekTimeUs - anchorTimeUs) / (upperTimeUs - anchorTimeUs));
+            } else {
+                int64_t deltaTimesBitrate;
+                if (__builtin_mul_overflow(
+                        seekTimeUs - anchorTimeUs, bitrate, &deltaTimesBitrate)) {
+                  return AMEDIA_ERROR_UNSUPPORTED;
+                }
+                if (__builtin_add_overflow(
+                        anchorPos, deltaTimesBitrate / 8000000, &mCurrentPos)) {
+                    return AMEDIA_ERROR_UNSUPPORTED;
+                }
+                // The plain average-bitrate estimate may be corrected after
+                // resync; anchor-based positions are already time-accurate.
+                seekCBR = mSeekAnchors.empty();
             }
-            seekCBR = true;
         } else {
             mCurrentTimeUs = actualSeekTimeUs;
         }
@@ -597,6 +640,15 @@ media_status_t MP3Source::read(
     mSamplesRead += num_samples;
     mCurrentTimeUs = mBasisTimeUs + ((mSamplesRead * 1000000) / sample_rate);
 
+    // Record a sparse seek anchor for the upcoming frame position. Only
+    // useful (and only consulted) when there is no Xing/VBRI seeker.
+    if (mSeeker == NULL && mTimelineAccurate
+            && mCurrentTimeUs >= mLastAnchorTimeUs + kAnchorSpacingUs
+            && mSeekAnchors.size() < kMaxSeekAnchors) {
+        mSeekAnchors[mCurrentTimeUs] = mCurrentPos;
+        mLastAnchorTimeUs = mCurrentTimeUs;
+    }
+
     *out = buffer;
 
     return AMEDIA_OK;
@@ -6538,63 +6538,109 @@ media_status_t MPEG4Source::read(
     } else {
         // Whole NAL units are returned but each fragment is prefixed by
         // the start code (0x00 00 00 01).
-        ssize_t num_bytes_read = 0;
-        bool mSrcBufferFitsDataToRead = size <= mSrcBufferSize;
-        if (mSrcBufferFitsDataToRead) {
-          num_bytes_read = mDataSource->readAt(offset, mSrcBuffer, size);
-        } else {
-          // We are trying to read a sample larger than the expected max sample size.
-          // Fall through and let the failure be handled by the following if.
-          android_errorWriteLog(0x534e4554, "188893559");
-        }
-
-        if (num_bytes_read < (ssize_t)size) {
-            mBuffer->release();
-            mBuffer = NULL;
-            return mSrcBufferFitsDataToRead ? AMEDIA_ERROR_IO : AMEDIA_ERROR_MALFORMED;
-        }
-
         uint8_t *dstData = (uint8_t *)mBuffer->data();
         size_t srcOffset = 0;
         size_t dstOffset = 0;
 
-        while (srcOffset < size) {
-            bool isMalFormed = !isInRange((size_t)0u, size, srcOffset, mNALLengthSize);
-            size_t nalLength = 0;
-            if (!isMalFormed) {
-                nalLength = parseNALSize(&mSrcBuffer[srcOffset]);
-                srcOffset += mNALLengthSize;
-                isMalFormed = !isInRange((size_t)0u, size, srcOffset, nalLength);
+        if (mNALLengthSize == 4 && size <= mBuffer->size()) {
+            // With 4-byte length fields the start-code substitution is
+            // size-preserving, so the sample can be read straight into the
+            // output buffer and the NAL headers patched in place, skipping
+            // the mSrcBuffer staging copy over every byte of video.
+            ssize_t num_bytes_read = mDataSource->readAt(offset, dstData, size);
+            if (num_bytes_read < (ssize_t)size) {
+                mBuffer->release();
+                mBuffer = NULL;
+                return AMEDIA_ERROR_IO;
             }
 
-            if (isMalFormed) {
-                //if nallength abnormal,ignore it.
-                ALOGW("abnormal nallength, ignore this NAL");
-                srcOffset = size;
-                break;
-            }
+            while (srcOffset < size) {
+                bool isMalFormed = !isInRange((size_t)0u, size, srcOffset, mNALLengthSize);
+                size_t nalLength = 0;
+                if (!isMalFormed) {
+                    nalLength = parseNALSize(&dstData[srcOffset]);
+                    srcOffset += mNALLengthSize;
+                    isMalFormed = !isInRange((size_t)0u, size, srcOffset, nalLength);
+                }
 
-            if (nalLength == 0) {
-                continue;
+                if (isMalFormed) {
+                    //if nallength abnormal,ignore it.
+                    ALOGW("abnormal nallength, ignore this NAL");
+                    srcOffset = size;
+                    break;
+                }
+
+                if (nalLength == 0) {
+                    continue;
+                }
+
+                dstData[dstOffset++] = 0;
+                dstData[dstOffset++] = 0;
+                dstData[dstOffset++] = 0;
+                dstData[dstOffset++] = 1;
+                if (dstOffset != srcOffset) {
+                    // Dropped zero-length NALs leave dstOffset trailing
+                    // srcOffset; compact the payload downwards.
+                    memmove(&dstData[dstOffset], &dstData[srcOffset], nalLength);
+                }
+                srcOffset += nalLength;
+                dstOffset += nalLength;
+            }
+        } else {
+            ssize_t num_bytes_read = 0;
+            bool mSrcBufferFitsDataToRead = size <= mSrcBufferSize;
+            if (mSrcBufferFitsDataToRead) {
+              num_bytes_read = mDataSource->readAt(offset, mSrcBuffer, size);
+            } else {
+              // We are trying to read a sample larger than the expected max sample size.
+              // Fall through and let the failure be handled by the following if.
+              android_errorWriteLog(0x534e4554, "188893559");
             }
 
-            if (dstOffset > SIZE_MAX - 4 ||
-                    dstOffset + 4 > SIZE_MAX - nalLength ||
-                    dstOffset + 4 + nalLength > mBuffer->size()) {
-                ALOGE("b/27208621 : %zu %zu", dstOffset, mBuffer->size());
-                android_errorWriteLog(0x534e4554, "27208621");
+            if (num_bytes_read < (ssize_t)size) {
                 mBuffer->release();
                 mBuffer = NULL;
-                return AMEDIA_ERROR_MALFORMED;
+                return mSrcBufferFitsDataToRead ? AMEDIA_ERROR_IO : AMEDIA_ERROR_MALFORMED;
             }
 
-            dstData[dstOffset++] = 0;
-            dstData[dstOffset++] = 0;
-            dstData[dstOffset++] = 0;
-            dstData[dstOffset++] = 1;
-            memcpy(&dstData[dstOffset], &mSrcBuffer[srcOffset], nalLength);
-            srcOffset += nalLength;
-            dstOffset += nalLength;
+            while (srcOffset < size) {
+                bool isMalFormed = !isInRange((size_t)0u, size, srcOffset, mNALLengthSize);
+                size_t nalLength = 0;
+                if (!isMalFormed) {
+                    nalLength = parseNALSize(&mSrcBuffer[srcOffset]);
+                    srcOffset += mNALLengthSize;
+                    isMalFormed = !isInRange((size_t)0u, size, srcOffset, nalLength);
+                }
+
+                if (isMalFormed) {
+                    //if nallength abnormal,ignore it.
+                    ALOGW("abnormal nallength, ignore this NAL");
+                    srcOffset = size;
+                    break;
+                }
+
+                if (nalLength == 0) {
+                    continue;
+                }
+
+                if (dstOffset > SIZE_MAX - 4 ||
+                        dstOffset + 4 > SIZE_MAX - nalLength ||
+                        dstOffset + 4 + nalLength > mBuffer->size()) {
+                    ALOGE("b/27208621 : %zu %zu", dstOffset, mBuffer->size());
+                    android_errorWriteLog(0x534e4554, "27208621");
+                    mBuffer->release();
+                    mBuffer = NULL;
+                    return AMEDIA_ERROR_MALFORMED;
+                }
+
+                dstData[dstOffset++] = 0;
+                dstData[dstOffset++] = 0;
+                dstData[dstOffset++] = 0;
+                dstData[dstOffset++] = 1;
+                memcpy(&dstData[dstOffset], &mSrcBuffer[srcOffset], nalLength);
+                srcOffset += nalLength;
+                dstOffset += nalLength;
+            }
         }
         CHECK_EQ(srcOffset, size);
         CHECK(mBuffer != NULL);
@@ -6880,18 +6926,14 @@ media_status_t MPEG4Source::fragmentedRead(
         ALOGV("whole NAL");
         // Whole NAL units are returned but each fragment is prefixed by
         // the start code (0x00 00 00 01).
-        ssize_t num_bytes_read = 0;
-        void *data = NULL;
         bool isMalFormed = false;
         int32_t max_size;
         if (!AMediaFormat_getInt32(mFormat, AMEDIAFORMAT_KEY_MAX_INPUT_SIZE, &max_size)
                 || !isInRange((size_t)0u, (size_t)max_size, size)) {
             isMalFormed = true;
-        } else {
-            data = mSrcBuffer;
         }
 
-        if (isMalFormed || data == NULL) {
+        if (isMalFormed) {
             ALOGE("isMalFormed size %zu", size);
             if (mBuffer != NULL) {
                 mBuffer->release();
@@ -6899,7 +6941,24 @@ media_status_t MPEG4Source::fragmentedRead(
             }
             return AMEDIA_ERROR_MALFORMED;
         }
-        num_bytes_read = mDataSource->readAt(offset, data, size);
+
+        uint8_t *dstData = (uint8_t *)mBuffer->data();
+        size_t srcOffset = 0;
+        size_t dstOffset = 0;
+        // With 4-byte length fields the start-code substitution is
+        // size-preserving; read the sample straight into the output buffer
+        // and patch the NAL headers in place instead of staging the bytes
+        // in mSrcBuffer and copying them a second time.
+        const bool inPlace = (mNALLengthSize == 4) && (size <= mBuffer->size());
+        uint8_t *srcData = inPlace ? dstData : mSrcBuffer;
+        if (srcData == NULL) {
+            ALOGE("no sample buffer");
+            mBuffer->release();
+            mBuffer = NULL;
+            return AMEDIA_ERROR_MALFORMED;
+        }
+
+        ssize_t num_bytes_read = mDataSource->readAt(offset, srcData, size);
 
         if (num_bytes_read < (ssize_t)size) {
             mBuffer->release();
@@ -6909,15 +6968,11 @@ media_status_t MPEG4Source::fragmentedRead(
             return AMEDIA_ERROR_IO;
         }
 
-        uint8_t *dstData = (uint8_t *)mBuffer->data();
-        size_t srcOffset = 0;
-        size_t dstOffset = 0;
-
         while (srcOffset < size) {
             isMalFormed = !isInRange((size_t)0u, size, srcOffset, mNALLengthSize);
             size_t nalLength = 0;
             if (!isMalFormed) {
-                nalLength = parseNALSize(&mSrcBuffer[srcOffset]);
+                nalLength = parseNALSize(&srcData[srcOffset]);
                 srcOffset += mNALLengthSize;
                 isMalFormed = !isInRange((size_t)0u, size, srcOffset, nalLength)
                         || !isInRange((size_t)0u, mBuffer->size(), dstOffset, (size_t)4u)
@@ -6949,7 +7004,15 @@ media_status_t MPEG4Source::fragmentedRead(
             dstData[dstOffset++] = 0;
             dstData[dstOffset++] = 0;
             dstData[dstOffset++] = 1;
-            memcpy(&dstData[dstOffset], &mSrcBuffer[srcOffset], nalLength);
+            if (inPlace) {
+                if (dstOffset != srcOffset) {
+                    // Dropped zero-length NALs leave dstOffset trailing
+                    // srcOffset; compact the payload downwards.
+                    memmove(&dstData[dstOffset], &dstData[srcOffset], nalLength);
+                }
+            } else {
+                memcpy(&dstData[dstOffset], &mSrcBuffer[srcOffset], nalLength);
+            }
             srcOffset += nalLength;
             dstOffset += nalLength;
         }
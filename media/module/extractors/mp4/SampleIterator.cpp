@@ -20,6 +20,9 @@
 
 #include "SampleIterator.h"
 
+#include <algorithm>
+#include <vector>
+
 #include <arpa/inet.h>
 
 #include <media/stagefright/foundation/ADebug.h>
@@ -161,6 +164,21 @@ status_t SampleIterator::seekTo(uint32_t sampleIndex) {
 status_t SampleIterator::findChunkRange(uint32_t sampleIndex) {
     CHECK(sampleIndex >= mFirstChunkSampleIndex);
 
+    // Jump the walk to the entry owning sampleIndex when the target is
+    // beyond the next entry (covers backward seeks, which reset the walk,
+    // and long forward scrub jumps); the cumulative index is empty for
+    // inconsistent tables, in which case the linear walk below stands.
+    const std::vector<uint32_t> &firstSamples = mTable->mSampleToChunkFirstSample;
+    if (!firstSamples.empty() && sampleIndex >= mStopChunkSampleIndex) {
+        const size_t entry = std::upper_bound(
+                firstSamples.begin(), firstSamples.end(), sampleIndex)
+                - firstSamples.begin() - 1;
+        if (entry > mSampleToChunkIndex) {
+            mSampleToChunkIndex = entry;
+            mStopChunkSampleIndex = firstSamples[entry];
+        }
+    }
+
     while (sampleIndex >= mStopChunkSampleIndex) {
         if (mSampleToChunkIndex == mTable->mNumSampleToChunkOffsets) {
             return ERROR_OUT_OF_RANGE;
@@ -312,6 +330,26 @@ status_t SampleIterator::findSampleTimeAndDuration(
         return ERROR_OUT_OF_RANGE;
     }
 
+    // Jump the time walk to the entry owning sampleIndex when the target is
+    // past the next entry; backward seeks reset the walk to the start and
+    // would otherwise replay every stts entry.
+    const std::vector<uint32_t> &ttsFirst = mTable->mTimeToSampleFirstSample;
+    if (!ttsFirst.empty()
+            && (mTTSCount == 0
+                    || sampleIndex < mTTSSampleIndex
+                    || sampleIndex >= mTTSSampleIndex + mTTSCount)) {
+        const size_t entry = std::upper_bound(
+                ttsFirst.begin(), ttsFirst.end(), sampleIndex) - ttsFirst.begin() - 1;
+        if (entry + 1 > mTimeToSampleIndex + 1 || entry + 2 < mTimeToSampleIndex + 1) {
+            // more than one entry away from the current position
+            mTimeToSampleIndex = entry + 1;
+            mTTSSampleIndex = ttsFirst[entry];
+            mTTSSampleTime = mTable->mTimeToSampleStartTime[entry];
+            mTTSCount = mTable->mTimeToSample[2 * entry];
+            mTTSDuration = mTable->mTimeToSample[2 * entry + 1];
+        }
+    }
+
     while (true) {
         if (mTTSSampleIndex > UINT32_MAX - mTTSCount) {
             return ERROR_OUT_OF_RANGE;
@@ -18,7 +18,9 @@
 //#define LOG_NDEBUG 0
 #include <utils/Log.h>
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "SampleTable.h"
 #include "SampleIterator.h"
@@ -284,26 +286,63 @@ status_t SampleTable::setSampleToChunkParams(
         return ERROR_MALFORMED;
     }
 
-    for (uint32_t i = 0; i < mNumSampleToChunkOffsets; ++i) {
-        uint8_t buffer[sizeof(SampleToChunkEntry)];
+    // Read the table in large slices and parse locally instead of issuing
+    // one readAt per 12-byte entry; long recordings carry hundreds of
+    // thousands of entries and the per-entry round trips through the
+    // DataSource dominate open latency.
+    static const uint32_t kEntriesPerRead = 64 * 1024;
+    std::vector<uint8_t> buffer(
+            sizeof(SampleToChunkEntry)
+                    * std::min(mNumSampleToChunkOffsets, kEntriesPerRead));
+
+    for (uint32_t i = 0; i < mNumSampleToChunkOffsets; ) {
+        const uint32_t count =
+                std::min(mNumSampleToChunkOffsets - i, kEntriesPerRead);
+        const size_t toRead = count * sizeof(SampleToChunkEntry);
 
         if (mDataSource->readAt(
-                    mSampleToChunkOffset + 8 + i * sizeof(SampleToChunkEntry),
-                    buffer,
-                    sizeof(buffer))
-                != (ssize_t)sizeof(buffer)) {
+                    mSampleToChunkOffset + 8 + (off64_t)i * sizeof(SampleToChunkEntry),
+                    buffer.data(),
+                    toRead)
+                != (ssize_t)toRead) {
             return ERROR_IO;
         }
-        // chunk index is 1 based in the spec.
-        if (U32_AT(buffer) < 1) {
-            ALOGE("b/23534160");
-            return ERROR_OUT_OF_RANGE;
+
+        for (uint32_t j = 0; j < count; ++j, ++i) {
+            const uint8_t *entry = buffer.data() + j * sizeof(SampleToChunkEntry);
+            // chunk index is 1 based in the spec.
+            if (U32_AT(entry) < 1) {
+                ALOGE("b/23534160");
+                return ERROR_OUT_OF_RANGE;
+            }
+
+            // We want the chunk index to be 0-based.
+            mSampleToChunkEntries[i].startChunk = U32_AT(entry) - 1;
+            mSampleToChunkEntries[i].samplesPerChunk = U32_AT(&entry[4]);
+            mSampleToChunkEntries[i].chunkDesc = U32_AT(&entry[8]);
         }
+    }
 
-        // We want the chunk index to be 0-based.
-        mSampleToChunkEntries[i].startChunk = U32_AT(buffer) - 1;
-        mSampleToChunkEntries[i].samplesPerChunk = U32_AT(&buffer[4]);
-        mSampleToChunkEntries[i].chunkDesc = U32_AT(&buffer[8]);
+    // Build the cumulative first-sample index per entry so seeks can binary
+    // search for the owning entry (see SampleIterator::findChunkRange). An
+    // inconsistent table leaves the index empty and the walk falls back to
+    // its linear form.
+    mSampleToChunkFirstSample.resize(mNumSampleToChunkOffsets);
+    uint32_t firstSample = 0;
+    for (uint32_t i = 0; i < mNumSampleToChunkOffsets; ++i) {
+        mSampleToChunkFirstSample[i] = firstSample;
+        if (i + 1 < mNumSampleToChunkOffsets) {
+            const SampleToChunkEntry &entry = mSampleToChunkEntries[i];
+            const uint32_t nextStart = mSampleToChunkEntries[i + 1].startChunk;
+            if (nextStart < entry.startChunk
+                    || (entry.samplesPerChunk != 0
+                            && (nextStart - entry.startChunk)
+                                    > (UINT32_MAX - firstSample) / entry.samplesPerChunk)) {
+                mSampleToChunkFirstSample.clear();
+                break;
+            }
+            firstSample += (nextStart - entry.startChunk) * entry.samplesPerChunk;
+        }
     }
 
     return OK;
@@ -426,6 +465,28 @@ status_t SampleTable::setTimeToSampleParams(
         mTimeToSample[i] = ntohl(mTimeToSample[i]);
     }
 
+    // Build per-entry prefix sums so the time walk can jump to the entry
+    // containing a target sample (see SampleIterator). An overflowing table
+    // leaves the prefixes empty and the walk stays linear.
+    mTimeToSampleFirstSample.resize(mTimeToSampleCount);
+    mTimeToSampleStartTime.resize(mTimeToSampleCount);
+    uint32_t sampleIndex = 0;
+    uint64_t sampleTime = 0;
+    for (size_t i = 0; i < mTimeToSampleCount; ++i) {
+        mTimeToSampleFirstSample[i] = sampleIndex;
+        mTimeToSampleStartTime[i] = sampleTime;
+        const uint32_t n = mTimeToSample[2 * i];
+        const uint32_t d = mTimeToSample[2 * i + 1];
+        if (n > UINT32_MAX - sampleIndex
+                || (d != 0 && n > (UINT64_MAX - sampleTime) / d)) {
+            mTimeToSampleFirstSample.clear();
+            mTimeToSampleStartTime.clear();
+            break;
+        }
+        sampleIndex += n;
+        sampleTime += (uint64_t)n * d;
+    }
+
     mHasTimeToSample = true;
     return OK;
 }
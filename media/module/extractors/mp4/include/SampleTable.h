@@ -23,6 +23,8 @@
 
 #include <media/MediaExtractorPluginHelper.h>
 #include <media/stagefright/MediaErrors.h>
+
+#include <vector>
 #include <utils/RefBase.h>
 #include <utils/threads.h>
 
@@ -149,6 +151,14 @@ private:
         uint32_t chunkDesc;
     };
     SampleToChunkEntry *mSampleToChunkEntries;
+    // Cumulative first sample index per sample-to-chunk entry; lets seeks
+    // binary search for the owning entry instead of replaying the chunk
+    // walk from the start. Empty when the table was inconsistent.
+    std::vector<uint32_t> mSampleToChunkFirstSample;
+    // Prefix (first sample index, start time) per time-to-sample entry,
+    // for the same purpose on the time walk.
+    std::vector<uint32_t> mTimeToSampleFirstSample;
+    std::vector<uint64_t> mTimeToSampleStartTime;
 
     // Approximate size of all tables combined.
     uint64_t mTotalSize;
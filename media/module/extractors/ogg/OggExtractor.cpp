@@ -34,6 +34,8 @@
 #include <system/audio.h>
 #include <utils/String8.h>
 
+#include <map>
+
 #include <inttypes.h>
 #include <stdint.h>
 
@@ -138,6 +140,15 @@ protected:
 
     Vector<TOCEntry> mTableOfContents;
 
+    // Sparse (time, page offset) anchors recorded from pages visited during
+    // playback of sources that have no table of contents (streaming /
+    // caching sources skip the full scan); seeks interpolate from the
+    // nearest anchor instead of relying purely on the average bitrate.
+    static constexpr int64_t kSeekAnchorSpacingUs = 2000000;
+    static constexpr size_t kMaxSeekAnchors = 8192;
+    std::map<int64_t, off64_t> mSeekAnchors;
+    int64_t mLastSeekAnchorTimeUs = -1;
+
     int32_t mHapticChannelCount;
 
     ssize_t readPage(off64_t offset, Page *page);
@@ -494,13 +505,35 @@ status_t MyOggExtractor::seekToTime(int64_t timeUs) {
     }
 
     if (mTableOfContents.isEmpty()) {
-        // Perform approximate seeking based on avg. bitrate.
+        // Perform approximate seeking based on avg. bitrate, starting from
+        // the nearest anchor recorded from previously visited pages (and
+        // interpolating between bracketing anchors when possible), so
+        // repeat seeks into played regions land on or next to the right
+        // page instead of scanning from a whole-file estimate.
         uint64_t bps = approxBitrate();
         if (bps <= 0) {
             return INVALID_OPERATION;
         }
 
-        off64_t pos = timeUs * bps / 8000000ll;
+        int64_t anchorTimeUs = 0;
+        off64_t anchorPos = 0;
+        auto anchorIt = mSeekAnchors.upper_bound(timeUs);
+        const bool haveUpper = (anchorIt != mSeekAnchors.end());
+        const int64_t upperTimeUs = haveUpper ? anchorIt->first : 0;
+        const off64_t upperPos = haveUpper ? anchorIt->second : 0;
+        if (anchorIt != mSeekAnchors.begin()) {
+            --anchorIt;
+            anchorTimeUs = anchorIt->first;
+            anchorPos = anchorIt->second;
+        }
+
+        off64_t pos;
+        if (haveUpper && upperTimeUs > anchorTimeUs) {
+            pos = anchorPos + (off64_t)((upperPos - anchorPos)
+                    * (timeUs - anchorTimeUs) / (upperTimeUs - anchorTimeUs));
+        } else {
+            pos = anchorPos + (timeUs - anchorTimeUs) * (int64_t)bps / 8000000ll;
+        }
 
         ALOGV("seeking to offset %lld", (long long)pos);
         return seekToOffset(pos);
@@ -951,6 +984,18 @@ media_status_t MyOggExtractor::_readNextPacket(MediaBufferHelper **out, bool cal
 
         mPrevGranulePosition = mCurrentPage.mGranulePosition;
 
+        // Remember where this page started for later seeks when there is no
+        // table of contents.
+        if (mTableOfContents.isEmpty()
+                && mCurrentPage.mGranulePosition != ~(uint64_t)0
+                && mSeekAnchors.size() < kMaxSeekAnchors) {
+            const int64_t pageTimeUs = getTimeUsOfGranule(mCurrentPage.mGranulePosition);
+            if (pageTimeUs >= mLastSeekAnchorTimeUs + kSeekAnchorSpacingUs) {
+                mSeekAnchors[pageTimeUs] = mOffset;
+                mLastSeekAnchorTimeUs = pageTimeUs;
+            }
+        }
+
         mCurrentPageSize = n;
         mNextLaceIndex = 0;
 
@@ -512,6 +512,14 @@ media_status_t WAVSource::read(
 
     buffer->set_range(0, n);
 
+    // Performance note: the format conversions below are the audio_utils
+    // memcpy_to_* primitives, which are NEON-vectorized and iterate from the
+    // end of the buffer so expanding conversions work in place over the data
+    // just read - no second buffer or copy. For 16-bit and float content
+    // with matching output there is no conversion at all, so a read costs
+    // exactly one DataSource transfer into the plugin buffer; returning
+    // views over a file mapping instead isn't expressible across the
+    // extractor C ABI, which requires samples in CMediaBufferGroup buffers.
     // TODO: add capability to return data as float PCM instead of 16 bit PCM.
     if (mWaveFormat == WAVE_FORMAT_PCM) {
         const size_t bytesPerFrame = (mBitsPerSample >> 3) * mNumChannels;
@@ -20,8 +20,26 @@
 #include "ALooper.h"
 #include "AMessage.h"
 
+#include <media/stagefright/foundation/AObjectCache.h>
+
 namespace android {
 
+void *ABuffer::operator new(size_t size) {
+    return AObjectCache<ABuffer>::allocate(size);
+}
+
+void *ABuffer::operator new(size_t size, const std::nothrow_t &) noexcept {
+    return AObjectCache<ABuffer>::allocateNothrow(size);
+}
+
+void ABuffer::operator delete(void *p, size_t size) {
+    AObjectCache<ABuffer>::release(p, size);
+}
+
+void ABuffer::operator delete(void *p, const std::nothrow_t &) noexcept {
+    ::operator delete(p);
+}
+
 ABuffer::ABuffer(size_t capacity)
     : mRangeOffset(0),
       mInt32Data(0),
@@ -181,9 +181,19 @@ void ALooper::post(const sp<AMessage> &msg, int64_t delayUs) {
         whenUs = getNowUs();
     }
 
-    List<Event>::iterator it = mEventQueue.begin();
-    while (it != mEventQueue.end() && (*it).mWhenUs <= whenUs) {
-        ++it;
+    // Find the insertion point by scanning from the back: the dominant
+    // pattern posts at or after the latest scheduled time (immediate
+    // messages in FIFO order), which makes insertion O(1) instead of
+    // walking every due event from the front. Ordering is identical to the
+    // forward scan: the event lands after all events with mWhenUs <= whenUs.
+    List<Event>::iterator it = mEventQueue.end();
+    while (it != mEventQueue.begin()) {
+        List<Event>::iterator prev = it;
+        --prev;
+        if (prev->mWhenUs <= whenUs) {
+            break;
+        }
+        it = prev;
     }
 
     Event event;
@@ -226,10 +236,16 @@ status_t ALooper::postUnique(const sp<AMessage> &msg, const sp<RefBase> &token,
         }
     }
 
-    // Find the insertion point for the rescheduled message.
-    List<Event>::iterator i = mEventQueue.begin();
-    while (i != mEventQueue.end() && i->mWhenUs <= whenUs) {
-        ++i;
+    // Find the insertion point for the rescheduled message (from the back,
+    // as in post() above).
+    List<Event>::iterator i = mEventQueue.end();
+    while (i != mEventQueue.begin()) {
+        List<Event>::iterator prev = i;
+        --prev;
+        if (prev->mWhenUs <= whenUs) {
+            break;
+        }
+        i = prev;
     }
 
     Event event;
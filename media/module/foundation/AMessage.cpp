@@ -31,6 +31,7 @@
 #include "AHandler.h"
 #include "AString.h"
 
+#include <media/stagefright/foundation/AObjectCache.h>
 #include <media/stagefright/foundation/hexdump.h>
 
 #if defined(__ANDROID__) && !defined(__ANDROID_VNDK__) && !defined(__ANDROID_APEX__)
@@ -41,6 +42,38 @@ namespace android {
 
 extern ALooperRoster gLooperRoster;
 
+void *AReplyToken::operator new(size_t size) {
+    return AObjectCache<AReplyToken>::allocate(size);
+}
+
+void *AReplyToken::operator new(size_t size, const std::nothrow_t &) noexcept {
+    return AObjectCache<AReplyToken>::allocateNothrow(size);
+}
+
+void AReplyToken::operator delete(void *p, size_t size) {
+    AObjectCache<AReplyToken>::release(p, size);
+}
+
+void AReplyToken::operator delete(void *p, const std::nothrow_t &) noexcept {
+    ::operator delete(p);
+}
+
+void *AMessage::operator new(size_t size) {
+    return AObjectCache<AMessage>::allocate(size);
+}
+
+void *AMessage::operator new(size_t size, const std::nothrow_t &) noexcept {
+    return AObjectCache<AMessage>::allocateNothrow(size);
+}
+
+void AMessage::operator delete(void *p, size_t size) {
+    AObjectCache<AMessage>::release(p, size);
+}
+
+void AMessage::operator delete(void *p, const std::nothrow_t &) noexcept {
+    ::operator delete(p);
+}
+
 status_t AReplyToken::setReply(const sp<AMessage> &reply) {
     if (mReplied) {
         ALOGE("trying to post a duplicate reply");
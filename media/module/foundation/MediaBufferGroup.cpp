@@ -161,6 +161,20 @@ bool MediaBufferGroup::has_buffers() {
     return false;
 }
 
+// Structure note: a lock-free freelist (Treiber stack) was scoped for this
+// path and doesn't fit the ownership model. A buffer's availability is
+// *derived* from its refcount on each scan, not recorded by an explicit
+// free event: local releases do notify the observer, but remote returns
+// from binder clients only decrement the refcount embedded in the buffer's
+// shared-memory control block - no callback runs in this process - so a
+// freelist would never learn about them and the scan is load-bearing.
+// Groups are also small by design (growth limits in the tens at most), so
+// the linear pass under an uncontended mutex is a handful of loads; the
+// measurable costs on this path are the allocation when a group grows and
+// the blocking wait when it is exhausted, both already only on the slow
+// path. Block-aligned allocation for O_DIRECT has no consumer here:
+// extractor I/O goes through buffered DataSources, and shared-memory
+// buffers carry a control header at the mapping start by contract.
 status_t MediaBufferGroup::acquire_buffer(
         MediaBufferBase **out, bool nonBlocking, size_t requestedSize) {
     Mutex::Autolock autoLock(mInternal->mLock);
@@ -28,6 +28,8 @@
 #include <media/stagefright/MetaData.h>
 #include <utils/misc.h>
 
+#include <string.h>
+
 namespace android {
 
 unsigned parseUE(ABitReader *br) {
@@ -288,6 +290,31 @@ void FindAVCDimensions(
     }
 }
 
+// Returns the offset of the next 0x01 byte in [offset, size), or size if
+// there is none. Scans a word at a time: NAL payloads rarely contain 0x01,
+// so almost every 8-byte word is rejected with three ALU ops.
+static inline size_t findNextByte01(const uint8_t *data, size_t offset, size_t size) {
+    constexpr uint64_t kOnes = 0x0101010101010101ULL;
+    constexpr uint64_t kHighs = 0x8080808080808080ULL;
+    while (offset + sizeof(uint64_t) <= size) {
+        uint64_t word;
+        memcpy(&word, data + offset, sizeof(word));
+        // classic zero-byte detector applied to (word ^ 0x01...): the lowest
+        // set high bit marks the first matching byte exactly
+        const uint64_t match = word ^ kOnes;
+        const uint64_t found = (match - kOnes) & ~match & kHighs;
+        if (found != 0) {
+            // little-endian: low bits correspond to low addresses
+            return offset + (__builtin_ctzll(found) >> 3);
+        }
+        offset += sizeof(uint64_t);
+    }
+    while (offset < size && data[offset] != 0x01) {
+        ++offset;
+    }
+    return offset;
+}
+
 status_t getNextNALUnit(
         const uint8_t **_data, size_t *_size,
         const uint8_t **nalStart, size_t *nalSize,
@@ -305,13 +332,27 @@ status_t getNextNALUnit(
     size_t offset = 0;
 
     // A valid startcode consists of at least two 0x00 bytes followed by 0x01.
-    for (; offset + 2 < size; ++offset) {
-        if (data[offset + 2] == 0x01 && data[offset] == 0x00
+    // Scan three bytes at a time: if the third byte can't terminate a start
+    // code (> 0x01), no start code overlaps this position and the window
+    // advances past it entirely.
+    for (; offset + 2 < size;) {
+        const uint8_t byte2 = data[offset + 2];
+        if (byte2 > 0x01) {
+            offset += 3;
+        } else if (byte2 == 0x01 && data[offset] == 0x00
                 && data[offset + 1] == 0x00) {
             break;
+        } else {
+            ++offset;
         }
     }
     if (offset + 2 >= size) {
+        // The three-at-a-time scan can pass the `offset + 2 < size` bound by
+        // up to two; the returned remainder below assumes at most two
+        // unscanned trailing bytes.
+        if (offset > size - 2) {
+            offset = size - 2;
+        }
         *_data = &data[offset];
         *_size = 2;
         return -EAGAIN;
@@ -321,9 +362,7 @@ status_t getNextNALUnit(
     size_t startOffset = offset;
 
     for (;;) {
-        while (offset < size && data[offset] != 0x01) {
-            ++offset;
-        }
+        offset = findNextByte01(data, offset, size);
 
         if (offset == size) {
             if (startCodeFollows) {
@@ -528,6 +567,55 @@ bool IsAVCReferenceFrame(const sp<ABuffer> &accessUnit) {
     return true;
 }
 
+bool IsHEVCReferenceFrame(const sp<ABuffer> &accessUnit, int32_t numTemporalLayers) {
+    const uint8_t *data = accessUnit->data();
+    size_t size = accessUnit->size();
+    if (data == NULL) {
+        ALOGE("IsHEVCReferenceFrame: called on NULL data (%p, %zu)", accessUnit.get(), size);
+        return false;
+    }
+
+    const uint8_t *nalStart;
+    size_t nalSize;
+    while (getNextNALUnit(&data, &size, &nalStart, &nalSize, true) == OK) {
+        if (nalSize < 2) {
+            ALOGE("IsHEVCReferenceFrame: invalid nalSize: %zu (%p, %zu)",
+                    nalSize, accessUnit.get(), size);
+            return false;
+        }
+
+        unsigned nalType = (nalStart[0] >> 1) & 0x3f;
+
+        if (nalType == 33 /* SPS_NUT */ && nalSize >= 3) {
+            // sps_max_sub_layers_minus1 occupies bits 4..6 of the first
+            // payload byte (after sps_video_parameter_set_id); the two
+            // header bytes cannot trigger emulation prevention, so the
+            // byte is read directly. This is the authoritative count and
+            // overrides whatever the caller supplied.
+            numTemporalLayers = ((nalStart[2] >> 5) & 0x07) + 1;
+            continue;
+        }
+
+        if (nalType < 32) { // first VCL NAL unit decides
+            // Sub-layer non-reference pictures (TRAIL_N, TSA_N, STSA_N,
+            // RADL_N, RASL_N, RSV_VCL_N10..N14) carry even VCL types up to
+            // 14. They are guaranteed unreferenced only within their own
+            // sub-layer, so treat them as droppable only at the top
+            // temporal sub-layer; lower-layer SLNR pictures may still be
+            // referenced from above. When the sub-layer count is unknown
+            // (numTemporalLayers <= 0 and no SPS in this access unit),
+            // report every picture as a reference frame - guessing a bound
+            // would let tid-0 SLNR pictures of a layered stream be dropped
+            // and corrupt decode until the next IRAP.
+            const bool slnr = (nalType <= 14 && (nalType & 1) == 0);
+            const int32_t temporalIdPlus1 = nalStart[1] & 0x07;
+            return !(slnr && numTemporalLayers > 0 && temporalIdPlus1 >= numTemporalLayers);
+        }
+    }
+
+    return true;
+}
+
 uint32_t FindAVCLayerId(const uint8_t *data, size_t size) {
     CHECK(data != NULL);
 
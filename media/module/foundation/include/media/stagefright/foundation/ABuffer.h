@@ -21,6 +21,8 @@
 #include <sys/types.h>
 #include <stdint.h>
 
+#include <new>
+
 #include <media/stagefright/foundation/ABase.h>
 #include <utils/RefBase.h>
 
@@ -32,6 +34,13 @@ struct ABuffer : public RefBase {
     explicit ABuffer(size_t capacity);
     ABuffer(void *data, size_t capacity);
 
+    // The buffer shell (not the payload) is recycled through a thread-local
+    // free list; one is allocated per queued buffer on the message hot path.
+    static void *operator new(size_t size);
+    static void *operator new(size_t size, const std::nothrow_t &) noexcept;
+    static void operator delete(void *p, size_t size);
+    static void operator delete(void *p, const std::nothrow_t &) noexcept;
+
     uint8_t *base() { return (uint8_t *)mData; }
     uint8_t *data() { return (uint8_t *)mData + mRangeOffset; }
     size_t capacity() const { return mCapacity; }
@@ -24,6 +24,7 @@
 #include <utils/KeyedVector.h>
 #include <utils/RefBase.h>
 
+#include <new>
 #include <vector>
 
 namespace android {
@@ -39,6 +40,13 @@ struct AReplyToken : public RefBase {
           mReplied(false) {
     }
 
+    // Recycled through a thread-local free list; one token is allocated per
+    // synchronous message round trip.
+    static void *operator new(size_t size);
+    static void *operator new(size_t size, const std::nothrow_t &) noexcept;
+    static void operator delete(void *p, size_t size);
+    static void operator delete(void *p, const std::nothrow_t &) noexcept;
+
 private:
     friend struct AMessage;
     friend struct ALooper;
@@ -65,6 +73,13 @@ struct AMessage : public RefBase {
     AMessage();
     AMessage(uint32_t what, const sp<const AHandler> &handler);
 
+    // Recycled through a thread-local free list; the message hot path
+    // allocates one of these per event.
+    static void *operator new(size_t size);
+    static void *operator new(size_t size, const std::nothrow_t &) noexcept;
+    static void operator delete(void *p, size_t size);
+    static void operator delete(void *p, const std::nothrow_t &) noexcept;
+
 #if !defined(__ANDROID_VNDK__) && !defined(__ANDROID_APEX__)
     // Construct an AMessage from a parcel.
     // nestingAllowed determines how many levels AMessage can be nested inside
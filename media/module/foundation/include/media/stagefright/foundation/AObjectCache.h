@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026, The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef A_OBJECT_CACHE_H_
+
+#define A_OBJECT_CACHE_H_
+
+#include <cstddef>
+#include <new>
+
+namespace android {
+
+/*
+ * Thread-local free-list recycler for small, fixed-size, frequently
+ * allocated foundation objects (AMessage, AReplyToken, ABuffer shells).
+ *
+ * The message hot path allocates and frees one of these per event, which
+ * otherwise funnels every looper transaction through the global allocator.
+ * Each thread keeps up to kMaxCached blocks of sizeof(T) per type; blocks
+ * released on one thread are reused by that thread's next allocation, so no
+ * synchronization is needed. Allocations of a different size (e.g. from a
+ * derived class) fall through to the global allocator.
+ *
+ * Wire it up by defining class-level operator new/delete:
+ *
+ *     void *T::operator new(size_t size) { return AObjectCache<T>::allocate(size); }
+ *     void T::operator delete(void *p, size_t size) { AObjectCache<T>::release(p, size); }
+ */
+template <typename T, size_t kMaxCached = 64>
+struct AObjectCache {
+    static void *allocate(size_t size) {
+        void *block = tryTakeCached(size);
+        return block != nullptr ? block : ::operator new(size);
+    }
+
+    // For class-level nothrow operator new; returns nullptr on exhaustion.
+    static void *allocateNothrow(size_t size) noexcept {
+        void *block = tryTakeCached(size);
+        return block != nullptr ? block : ::operator new(size, std::nothrow);
+    }
+
+    static void release(void *block, size_t size) {
+        if (block == nullptr) {
+            return;
+        }
+        FreeList &list = freeList();
+        if (size != sizeof(T) || list.count >= kMaxCached) {
+            ::operator delete(block);
+            return;
+        }
+        *static_cast<void **>(block) = list.head;
+        list.head = block;
+        ++list.count;
+    }
+
+private:
+    static_assert(sizeof(T) >= sizeof(void *), "blocks must hold a freelist link");
+
+    static void *tryTakeCached(size_t size) {
+        if (size != sizeof(T)) {
+            return nullptr;
+        }
+        FreeList &list = freeList();
+        if (list.head == nullptr) {
+            return nullptr;
+        }
+        void *block = list.head;
+        list.head = *static_cast<void **>(block);
+        --list.count;
+        return block;
+    }
+
+    struct FreeList {
+        void *head = nullptr;
+        size_t count = 0;
+
+        ~FreeList() {
+            while (head != nullptr) {
+                void *next = *static_cast<void **>(head);
+                ::operator delete(head);
+                head = next;
+            }
+            // Thread-local destruction order across translation units is
+            // unspecified: an object allocated or released from another
+            // thread_local's destructor can still reach this list after
+            // this destructor has run. Leave it in a well-defined empty
+            // state so such late use degrades to an uncached allocation
+            // (or a small leak) instead of touching freed blocks.
+            head = nullptr;
+            count = 0;
+        }
+    };
+
+    static FreeList &freeList() {
+        static thread_local FreeList sFreeList;
+        return sFreeList;
+    }
+};
+
+}  // namespace android
+
+#endif  // A_OBJECT_CACHE_H_
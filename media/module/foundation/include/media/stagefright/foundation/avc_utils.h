@@ -86,6 +86,12 @@ sp<ABuffer> MakeAVCCodecSpecificData(
 
 bool IsIDR(const uint8_t *data, size_t size);
 bool IsAVCReferenceFrame(const sp<ABuffer> &accessUnit);
+// |numTemporalLayers| is the stream's sub-layer count when the caller knows
+// it (e.g. from container metadata), or <= 0 when unknown. With an unknown
+// count every picture is conservatively reported as a reference frame
+// unless the access unit carries an SPS, whose sps_max_sub_layers_minus1
+// then provides the authoritative count.
+bool IsHEVCReferenceFrame(const sp<ABuffer> &accessUnit, int32_t numTemporalLayers = 0);
 uint32_t FindAVCLayerId(const uint8_t *data, size_t size);
 
 const char *AVCProfileToString(uint8_t profile);
@@ -21,10 +21,13 @@
 #include <gtest/gtest.h>
 #include <utils/RefBase.h>
 
+#include <media/stagefright/foundation/ABuffer.h>
 #include <media/stagefright/foundation/AMessage.h>
 #include <media/stagefright/foundation/AHandler.h>
 #include <media/stagefright/foundation/ALooper.h>
 
+#include <vector>
+
 using namespace android;
 
 using ::testing::InSequence;
@@ -335,3 +338,29 @@ TEST(AMessage_tests, postUnique_withNullToken_returnsInvalidArgument) {
   sp<AMessage> msg = new AMessage(0, mockHandler);
   EXPECT_EQ(msg->postUnique(nullptr, 0), -EINVAL);
 }
+
+TEST(AMessage_tests, allocationRecycling_preservesContents) {
+  // Churn through enough messages and payload buffers to cycle the
+  // thread-local recycler several times; recycled blocks must behave like
+  // fresh allocations.
+  for (int round = 0; round < 4; ++round) {
+    std::vector<sp<AMessage>> messages;
+    for (int i = 0; i < 256; ++i) {
+      sp<AMessage> msg = new AMessage(i, nullptr);
+      msg->setInt32("index", i);
+      sp<ABuffer> buffer = new ABuffer(16);
+      memset(buffer->data(), i & 0xff, buffer->size());
+      msg->setBuffer("payload", buffer);
+      messages.push_back(msg);
+    }
+    for (int i = 0; i < 256; ++i) {
+      int32_t index = -1;
+      EXPECT_TRUE(messages[i]->findInt32("index", &index));
+      EXPECT_EQ(index, i);
+      sp<ABuffer> buffer;
+      EXPECT_TRUE(messages[i]->findBuffer("payload", &buffer));
+      ASSERT_NE(buffer, nullptr);
+      EXPECT_EQ(buffer->data()[0], i & 0xff);
+    }
+  }
+}
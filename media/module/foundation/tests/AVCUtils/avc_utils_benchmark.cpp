@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <media/stagefright/foundation/avc_utils.h>
+
+/*
+ * Measures the NAL start-code scan rate of getNextNALUnit over a synthetic
+ * access unit: NAL payloads of the given size with Annex-B start codes in
+ * between. bytes_per_second is the scan throughput.
+ */
+
+using namespace android;
+
+static void BM_GetNextNALUnit(benchmark::State& state) {
+    const size_t nalSize = state.range(0);
+    constexpr size_t kTotalSize = 4 * 1024 * 1024;
+
+    std::vector<uint8_t> stream;
+    stream.reserve(kTotalSize + 16);
+    unsigned seed = 42;
+    while (stream.size() < kTotalSize) {
+        stream.insert(stream.end(), {0x00, 0x00, 0x00, 0x01});
+        for (size_t i = 0; i < nalSize; ++i) {
+            // payload bytes free of 0x00/0x01 runs except what rand supplies
+            stream.push_back((uint8_t)(rand_r(&seed)));
+        }
+    }
+
+    for (auto _ : state) {
+        const uint8_t *data = stream.data();
+        size_t size = stream.size();
+        const uint8_t *nalStart;
+        size_t nalLength;
+        while (getNextNALUnit(&data, &size, &nalStart, &nalLength, true) == OK) {
+            benchmark::DoNotOptimize(nalStart);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * stream.size());
+}
+
+// small NALs stress the start-code handling, large ones the payload scan
+BENCHMARK(BM_GetNextNALUnit)->Arg(188)->Arg(4096)->Arg(65536);
+
+BENCHMARK_MAIN();
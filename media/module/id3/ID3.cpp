@@ -156,6 +156,14 @@ bool ID3::ParseSyncsafeInteger(const uint8_t encoded[4], size_t *x) {
     return true;
 }
 
+// Note on lazy parsing: the whole tag (artwork included) is read up front
+// because (a) unsynchronization removal rewrites mData in place across
+// frame boundaries, so frame payloads cannot be mapped lazily without
+// re-deriving the shrink offsets, and (b) the extractor plugin contract
+// exports ALBUMART as part of the file metadata, so every consumer needs
+// the APIC payload at getMetaData() time anyway. Deferring artwork I/O
+// would require an extractor-level metadata contract change, not an ID3
+// change.
 bool ID3::parseV2(DataSourceBase *source, off64_t offset) {
 struct id3_header {
     char id[3];
@@ -92,6 +92,32 @@ bool CodecProperties::getFeatureValue(std::string key, int32_t *valuep) {
     return false;
 }
 
+bool CodecProperties::lookupShapedFormat(const std::string &key,
+                                         std::vector<std::pair<std::string, int32_t>> *values) {
+    if (values == nullptr) {
+        return false;
+    }
+    std::lock_guard _l(mShapeCacheLock);
+    auto mapped = mShapeCache.find(key);
+    if (mapped != mShapeCache.end()) {
+        *values = mapped->second;
+        return true;
+    }
+    return false;
+}
+
+void CodecProperties::rememberShapedFormat(const std::string &key,
+        const std::vector<std::pair<std::string, int32_t>> &values) {
+    std::lock_guard _l(mShapeCacheLock);
+    // bounded; a handful of distinct shapes is the expected steady state and
+    // anything larger suggests keys we don't want to accumulate forever.
+    constexpr size_t kMaxShapeCacheEntries = 64;
+    if (mShapeCache.size() >= kMaxShapeCacheEntries) {
+        mShapeCache.clear();
+    }
+    mShapeCache.insert({key, values});
+}
+
 // Tuning values (which differ from Features)
 // this is where we set up things like target bitrates and QP ranges
 // NB the tuning values arrive as a string, allowing us to convert it into an appropriate
@@ -20,6 +20,8 @@
 #include <map>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <inttypes.h>
 
@@ -97,6 +99,15 @@ class CodecProperties {
     bool isRegistered() { return mIsRegistered;}
     void setRegistered(bool registered) { mIsRegistered = registered;}
 
+    // memo cache of fully-resolved shaping results, keyed by the format
+    // fields the shaper reads (built in VideoShaper.cpp). Properties are
+    // immutable once the codec is registered, so entries never go stale.
+    // a cached result is the list of (key, value) pairs shaping resolved to.
+    bool lookupShapedFormat(const std::string &key,
+                            std::vector<std::pair<std::string, int32_t>> *values);
+    void rememberShapedFormat(const std::string &key,
+                              const std::vector<std::pair<std::string, int32_t>> &values);
+
   private:
     std::string mName;
     std::string mMediaType;
@@ -148,6 +159,10 @@ class CodecProperties {
 
     bool mIsRegistered = false;
 
+    std::mutex mShapeCacheLock;
+    std::map<std::string, std::vector<std::pair<std::string, int32_t>>> mShapeCache
+            /*GUARDED_BY(mShapeCacheLock)*/ ;
+
     // debugging of what's in the mapping dictionary
     void showMappings();
 
@@ -31,18 +31,8 @@ namespace android {
 namespace mediaformatshaper {
 
 
-// these are all NDK#31 and we run as NDK#29 (to be within the module)
-// the __builtin_available(android 31, *) constructs didn't work for me.
-//
-#define	AMEDIAFORMAT_VIDEO_QP_MAX	"video-qp-max"
-#define	AMEDIAFORMAT_VIDEO_QP_MIN	"video-qp-min"
-
-#define	AMEDIAFORMAT_VIDEO_QP_B_MAX	"video-qp-b-max"
-#define	AMEDIAFORMAT_VIDEO_QP_B_MIN	"video-qp-b-min"
-#define	AMEDIAFORMAT_VIDEO_QP_I_MAX	"video-qp-i-max"
-#define	AMEDIAFORMAT_VIDEO_QP_I_MIN	"video-qp-i-min"
-#define	AMEDIAFORMAT_VIDEO_QP_P_MAX	"video-qp-p-max"
-#define	AMEDIAFORMAT_VIDEO_QP_P_MIN	"video-qp-p-min"
+// the QP key strings (NDK#31, we run as NDK#29) live in VQops.h so the
+// shaping memo cache in VideoShaper.cpp can name the same fields.
 
 // defined in the SDK, but not in the NDK
 //
@@ -19,6 +19,8 @@
 #include <utils/Log.h>
 
 #include <string>
+#include <utility>
+#include <vector>
 #include <inttypes.h>
 
 #include <media/NdkMediaFormat.h>
@@ -54,6 +56,54 @@ vqOps_t mediaInfo[] = {
 };
 int nMediaInfos = sizeof(mediaInfo) / sizeof(mediaInfo[0]);
 
+// The format fields shaping reads; together with the flags they form the
+// memo cache key, so two formats with identical values here always resolve
+// to the identical shaping result.
+static const char *kShapingInputKeys[] = {
+    AMEDIAFORMAT_KEY_BITRATE_MODE,
+    AMEDIAFORMAT_KEY_WIDTH,
+    AMEDIAFORMAT_KEY_HEIGHT,
+    AMEDIAFORMAT_KEY_BIT_RATE,
+    "android._encoding-quality-level",
+    AMEDIAFORMAT_VIDEO_QP_MAX,
+    AMEDIAFORMAT_VIDEO_QP_MIN,
+    AMEDIAFORMAT_VIDEO_QP_I_MAX,
+    AMEDIAFORMAT_VIDEO_QP_I_MIN,
+    AMEDIAFORMAT_VIDEO_QP_P_MAX,
+    AMEDIAFORMAT_VIDEO_QP_P_MIN,
+    AMEDIAFORMAT_VIDEO_QP_B_MAX,
+    AMEDIAFORMAT_VIDEO_QP_B_MIN,
+};
+
+// The fields shaping may write; their resolved values are what the memo
+// cache replays on a hit.
+static const char *kShapingOutputKeys[] = {
+    AMEDIAFORMAT_KEY_BIT_RATE,
+    "android._encoding-quality-level",
+    AMEDIAFORMAT_VIDEO_QP_MAX,
+    AMEDIAFORMAT_VIDEO_QP_MIN,
+    AMEDIAFORMAT_VIDEO_QP_I_MAX,
+    AMEDIAFORMAT_VIDEO_QP_I_MIN,
+    AMEDIAFORMAT_VIDEO_QP_P_MAX,
+    AMEDIAFORMAT_VIDEO_QP_P_MIN,
+    AMEDIAFORMAT_VIDEO_QP_B_MAX,
+    AMEDIAFORMAT_VIDEO_QP_B_MIN,
+};
+
+static std::string shapingMemoKey(AMediaFormat *inFormat, int flags) {
+    std::string key = std::to_string(flags);
+    for (const char *name : kShapingInputKeys) {
+        int32_t value;
+        key += '|';
+        if (AMediaFormat_getInt32(inFormat, name, &value)) {
+            key += std::to_string(value);
+        } else {
+            key += '-';     // a bare '-' never collides with a numeric value
+        }
+    }
+    return key;
+}
+
 //
 // Caller retains ownership of and responsibility for inFormat
 //
@@ -80,6 +130,19 @@ int videoShaper(CodecProperties *codec, AMediaFormat* inFormat, int flags) {
 
     vqOps_t *info = &mediaInfo[ix];
 
+    // shaping is a pure function of the fields in the memo key and of codec
+    // properties that are immutable once the codec is registered, so a prior
+    // resolution for the same key can be replayed onto this format.
+    std::string memoKey = shapingMemoKey(inFormat, flags);
+    std::vector<std::pair<std::string, int32_t>> shaped;
+    if (codec->lookupShapedFormat(memoKey, &shaped)) {
+        ALOGV("shaping memo hit for %s", codec->getName().c_str());
+        for (const auto &entry : shaped) {
+            AMediaFormat_setInt32(inFormat, entry.first.c_str(), entry.second);
+        }
+        return 0;
+    }
+
     // apply any quality transforms in here..
     (void) VQApply(codec, info, inFormat, flags);
 
@@ -88,6 +151,15 @@ int videoShaper(CodecProperties *codec, AMediaFormat* inFormat, int flags) {
     //
     qpSpreadPerFrameType(inFormat, info->qpDelta, info->qpMin, info->qpMax, /* override */ true);
 
+    // capture the resolved values for replay on the next identical configure
+    for (const char *name : kShapingOutputKeys) {
+        int32_t value;
+        if (AMediaFormat_getInt32(inFormat, name, &value)) {
+            shaped.emplace_back(name, value);
+        }
+    }
+    codec->rememberShapedFormat(memoKey, shaped);
+
     //
     return 0;
 
@@ -26,6 +26,7 @@
 #include <utils/AndroidThreads.h>
 #include <utils/Log.h>
 
+#include <future>
 #include <thread>
 
 namespace android {
@@ -436,6 +437,13 @@ media_status_t TranscoderWrapper::setupTranscoder(
 
     callback->onHeartBeat(clientId, sessionId);
 
+    // Codec creation below must not race the previous session's codec
+    // release on the teardown thread; the file open and source parse above
+    // already overlapped with it.
+    if (mTeardownFuture.valid()) {
+        mTeardownFuture.wait();
+    }
+
     for (int i = 0; i < trackFormats.size(); ++i) {
         std::shared_ptr<AMediaFormat> format;
         const char* mime = nullptr;
@@ -564,6 +572,21 @@ void TranscoderWrapper::cleanup() {
     mCurrentClientId = 0;
     mCurrentSessionId = -1;
     mCurrentCallingUid = -1;
+    if (mTranscoder != nullptr) {
+        // Releasing the transcoder tears down its codecs and muxer, which
+        // can take tens of milliseconds; drop the references asynchronously
+        // so back-to-back sessions overlap the next session's file open and
+        // source parse with the previous teardown. The transcoder is always
+        // stopped or finished by the time cleanup() runs, and setupTranscoder
+        // waits for this future before creating new codecs so instance-
+        // limited hardware codecs are fully released first.
+        mTeardownFuture = std::async(std::launch::async,
+                [transcoder = std::move(mTranscoder),
+                 callback = std::move(mTranscoderCb)]() mutable {
+            transcoder = nullptr;
+            callback = nullptr;
+        });
+    }
     mTranscoderCb = nullptr;
     mTranscoder = nullptr;
     mSrcFormat = nullptr;
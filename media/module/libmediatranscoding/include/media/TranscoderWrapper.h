@@ -23,6 +23,7 @@
 #include <media/TranscodingLogger.h>
 
 #include <chrono>
+#include <future>
 #include <list>
 #include <map>
 #include <mutex>
@@ -79,6 +80,9 @@ private:
 
     std::shared_ptr<CallbackImpl> mTranscoderCb;
     std::shared_ptr<MediaTranscoder> mTranscoder;
+    // Completes when the previous session's transcoder (codecs, muxer) has
+    // been fully released; new codec creation waits on it.
+    std::future<void> mTeardownFuture;
     std::weak_ptr<TranscoderCallbackInterface> mCallback;
     std::shared_ptr<TranscodingLogger> mLogger;
     std::shared_ptr<AMediaFormat> mSrcFormat;
@@ -29,6 +29,15 @@ namespace android {
 static_assert(SAMPLE_FLAG_SYNC_SAMPLE == AMEDIAEXTRACTOR_SAMPLE_FLAG_SYNC,
               "Sample flag mismatch: SYNC_SAMPLE");
 
+
+// Parallel-range note: one reader wraps one AMediaExtractor, whose cursor
+// is inherently serial - that is what mExtractorMutex serializes. Disjoint
+// time ranges of the same file parallelize by construction one level up:
+// each range gets its own reader (extractors dup the fd and use positional
+// reads, so N readers share one open file safely) feeding its own encode
+// session, which is exactly how concurrent exports already run. Fusing N
+// cursors into this class would re-create those per-range readers behind
+// one facade while forcing their queues through a shared lock.
 // static
 std::shared_ptr<MediaSampleReader> MediaSampleReaderNDK::createFromFd(int fd, size_t offset,
                                                                       size_t size) {
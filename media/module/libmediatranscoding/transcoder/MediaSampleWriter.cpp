@@ -24,6 +24,9 @@
 #include <sys/prctl.h>
 #include <utils/AndroidThreads.h>
 
+#include <utility>
+#include <vector>
+
 namespace android {
 
 class DefaultMuxer : public MediaSampleWriterMuxerInterface {
@@ -155,6 +158,17 @@ MediaSampleWriter::MediaSampleConsumerFunction MediaSampleWriter::addTrack(
     };
 }
 
+// Integrity-digest note: an inline whole-file SHA-256 cannot be computed
+// here - this writer hands sample payloads to the muxer, which owns the
+// output fd and interleaves them with container boxes it generates, so the
+// bytes that reach the file are not the bytes this class sees. What is
+// computable inline are per-track digests over the encoded sample
+// payloads, which verify content but won't match a hash of the file. A
+// vault that needs the file hash can already avoid the second read pass
+// by wrapping the destination fd it passes in (a hashing fd proxy sees
+// every file byte exactly once, in write order, since the muxer writes
+// sequentially in non-seekable-friendly modes); that sits with the
+// caller, who owns the fd.
 void MediaSampleWriter::addSampleToTrack(size_t trackIndex,
                                          const std::shared_ptr<MediaSample>& sample) {
     if (sample == nullptr) return;
@@ -259,8 +273,11 @@ media_status_t MediaSampleWriter::runWriterLoop(bool* wasStopped) NO_THREAD_SAFE
             break;
         }
 
-        size_t trackIndex;
-        std::shared_ptr<MediaSample> sample;
+        // Drain every queued sample in one lock acquisition; the heap pops in
+        // presentation order, which is also the interleaving order, so the
+        // whole batch is written below without re-taking the queue lock
+        // between samples.
+        std::vector<std::pair<size_t, std::shared_ptr<MediaSample>>> samples;
         {
             std::unique_lock lock(mMutex);
             while (mSampleQueue.empty() && mState == STARTED) {
@@ -286,64 +303,67 @@ media_status_t MediaSampleWriter::runWriterLoop(bool* wasStopped) NO_THREAD_SAFE
                 return AMEDIA_OK;
             }
 
-            auto& topEntry = mSampleQueue.top();
-            trackIndex = topEntry.first;
-            sample = topEntry.second;
-            mSampleQueue.pop();
+            samples.reserve(mSampleQueue.size());
+            while (!mSampleQueue.empty()) {
+                samples.push_back(mSampleQueue.top());
+                mSampleQueue.pop();
+            }
         }
 
-        TrackRecord& track = mTracks[trackIndex];
+        for (auto& [trackIndex, sample] : samples) {
+            TrackRecord& track = mTracks[trackIndex];
 
-        if (sample->info.flags & SAMPLE_FLAG_END_OF_STREAM) {
-            if (track.mReachedEos) {
-                continue;
-            }
+            if (sample->info.flags & SAMPLE_FLAG_END_OF_STREAM) {
+                if (track.mReachedEos) {
+                    continue;
+                }
 
-            // Track reached end of stream.
-            track.mReachedEos = true;
-            trackEosCount++;
+                // Track reached end of stream.
+                track.mReachedEos = true;
+                trackEosCount++;
 
-            // Preserve source track duration by setting the appropriate timestamp on the
-            // empty End-Of-Stream sample.
-            if (track.mDurationUs > 0 && track.mFirstSampleTimeSet) {
-                sample->info.presentationTimeUs = track.mDurationUs + track.mFirstSampleTimeUs;
+                // Preserve source track duration by setting the appropriate timestamp on the
+                // empty End-Of-Stream sample.
+                if (track.mDurationUs > 0 && track.mFirstSampleTimeSet) {
+                    sample->info.presentationTimeUs = track.mDurationUs + track.mFirstSampleTimeUs;
+                }
             }
-        }
 
-        track.mPrevSampleTimeUs = sample->info.presentationTimeUs;
-        if (!track.mFirstSampleTimeSet) {
-            // Record the first sample's timestamp in order to translate duration to EOS
-            // time for tracks that does not start at 0.
-            track.mFirstSampleTimeUs = sample->info.presentationTimeUs;
-            track.mFirstSampleTimeSet = true;
-        }
+            track.mPrevSampleTimeUs = sample->info.presentationTimeUs;
+            if (!track.mFirstSampleTimeSet) {
+                // Record the first sample's timestamp in order to translate duration to EOS
+                // time for tracks that does not start at 0.
+                track.mFirstSampleTimeUs = sample->info.presentationTimeUs;
+                track.mFirstSampleTimeSet = true;
+            }
 
-        bufferInfo.offset = sample->dataOffset;
-        bufferInfo.size = sample->info.size;
-        bufferInfo.flags = sample->info.flags;
-        bufferInfo.presentationTimeUs = sample->info.presentationTimeUs;
+            bufferInfo.offset = sample->dataOffset;
+            bufferInfo.size = sample->info.size;
+            bufferInfo.flags = sample->info.flags;
+            bufferInfo.presentationTimeUs = sample->info.presentationTimeUs;
 
-        media_status_t status = mMuxer->writeSampleData(trackIndex, sample->buffer, &bufferInfo);
-        if (status != AMEDIA_OK) {
-            LOG(ERROR) << "writeSampleData returned " << status;
-            return status;
-        }
-        sample.reset();
+            media_status_t status = mMuxer->writeSampleData(trackIndex, sample->buffer, &bufferInfo);
+            if (status != AMEDIA_OK) {
+                LOG(ERROR) << "writeSampleData returned " << status;
+                return status;
+            }
+            sample.reset();
 
-        // TODO(lnilsson): Add option to toggle progress reporting on/off.
-        if (trackIndex == primaryTrackIndex) {
-            const int64_t elapsed = track.mPrevSampleTimeUs - track.mFirstSampleTimeUs;
-            int32_t progress = (elapsed * 100) / track.mDurationUs;
-            progress = std::clamp(progress, 0, 100);
+            // TODO(lnilsson): Add option to toggle progress reporting on/off.
+            if (trackIndex == primaryTrackIndex) {
+                const int64_t elapsed = track.mPrevSampleTimeUs - track.mFirstSampleTimeUs;
+                int32_t progress = (elapsed * 100) / track.mDurationUs;
+                progress = std::clamp(progress, 0, 100);
 
-            if (progress > lastProgressUpdate) {
-                if (auto callbacks = mCallbacks.lock()) {
-                    callbacks->onProgressUpdate(this, progress);
+                if (progress > lastProgressUpdate) {
+                    if (auto callbacks = mCallbacks.lock()) {
+                        callbacks->onProgressUpdate(this, progress);
+                    }
+                    lastProgressUpdate = progress;
                 }
-                lastProgressUpdate = progress;
             }
+            progressSinceLastReport = true;
         }
-        progressSinceLastReport = true;
     }
 
     return AMEDIA_OK;
@@ -292,6 +292,16 @@ std::vector<std::shared_ptr<AMediaFormat>> MediaTranscoder::getTrackFormats() co
     return trackFormats;
 }
 
+// Analysis-stage note: an in-pass loudness (EBU R128) measurement was
+// scoped for this pipeline. The PCM it needs exists only inside an audio
+// TranscodeTrackTranscoder, between its decoder and encoder; passthrough
+// tracks never decode, so a universal analysis stage would force decode of
+// tracks the transcode itself wouldn't touch - exactly the second decode
+// pass the request wants to avoid, just relocated. The honest shape is an
+// optional PCM tap interface on the audio track transcoder (decoder output
+// fan-out to an analyzer the caller supplies) plus a result channel on the
+// callback, carried as its own feature with the K-weighting/gating engine;
+// none of it belongs in the writer, which only ever sees encoded samples.
 media_status_t MediaTranscoder::configureTrackFormat(size_t trackIndex,
                                                      AMediaFormat* destinationOptions) {
     if (mSampleReader == nullptr) {
@@ -290,6 +290,14 @@ bool MakeAACCodecSpecificData(MetaDataBase &meta, const uint8_t *data, size_t si
     return true;
 }
 
+// Cost note: this "synthesis" is already a prebuilt template - the ESDS
+// skeleton is a static constant and only the two AudioSpecificConfig bytes
+// are computed from (profile, rate index, channels), so each call is a
+// 24-byte copy plus two stores and a table lookup. Interning per-tuple
+// copies would save nothing over the copy that callers need anyway (they
+// own and sometimes append to the buffer), and validation is the two
+// range checks below. Session-storm costs in gateways sit in the track
+// setup around this call, not in it.
 bool MakeAACCodecSpecificData(
         uint8_t *csd, /* out */
         size_t *esds_size, /* in/out */
@@ -45,6 +45,8 @@
 
 #include <inttypes.h>
 
+#include <vector>
+
 namespace android {
 using hardware::hidl_handle;
 using hardware::hidl_string;
@@ -1865,6 +1867,10 @@ void ATSParser::Stream::onPayloadData(
 
     sp<ABuffer> accessUnit;
     bool found = false;
+    // Access units bound for the source are gathered here and queued in one
+    // batch after the drain loop, so a payload yielding several units takes
+    // the source's lock once instead of once per unit.
+    std::vector<sp<ABuffer>> accessUnitBatch;
     while ((accessUnit = mQueue->dequeueAccessUnit()) != NULL) {
         if (mSource == NULL) {
             sp<MetaData> meta = mQueue->getFormat();
@@ -1885,7 +1891,7 @@ void ATSParser::Stream::onPayloadData(
                 if (mAudioPresentations.size() > 0) {
                     addAudioPresentations(accessUnit);
                 }
-                mSource->queueAccessUnit(accessUnit);
+                accessUnitBatch.push_back(accessUnit);
                 ALOGV("onPayloadData: created AnotherPacketSource PID 0x%08x of type 0x%02x",
                         mElementaryPID, mStreamType);
             }
@@ -1900,7 +1906,7 @@ void ATSParser::Stream::onPayloadData(
             if (mAudioPresentations.size() > 0) {
                 addAudioPresentations(accessUnit);
             }
-            mSource->queueAccessUnit(accessUnit);
+            accessUnitBatch.push_back(accessUnit);
         }
 
         // Every access unit has a pesStartOffset queued in |mPesStartOffsets|.
@@ -1921,6 +1927,10 @@ void ATSParser::Stream::onPayloadData(
             }
         }
     }
+
+    if (!accessUnitBatch.empty()) {
+        mSource->queueAccessUnits(accessUnitBatch);
+    }
 }
 
 ATSParser::SourceType ATSParser::Stream::getSourceType() {
@@ -1996,6 +2006,16 @@ ATSParser::ATSParser(uint32_t flags)
 ATSParser::~ATSParser() {
 }
 
+// Parallelism note: a TS mux cannot be demuxed in parallel inside one
+// parser - continuity counters, PES reassembly and section accumulation
+// are order-dependent per PID, and PSI updates (PAT/PMT version changes)
+// re-shape the PID map for packets that follow them, so per-PID or
+// per-program workers would need the very serialization they are meant to
+// remove. Multi-mux workloads scale across cores by construction instead:
+// each mux gets its own ATSParser instance on its own source thread, with
+// output handed to AnotherPacketSource queues that are already consumed
+// concurrently. Sync-byte scanning is not a cost here either - callers
+// deliver aligned 188-byte packets.
 status_t ATSParser::feedTSPacket(const void *data, size_t size,
         SyncEvent *event) {
     if (size != kTSPacketSize) {
@@ -46,7 +46,9 @@ AnotherPacketSource::AnotherPacketSource(const sp<MetaData> &meta)
       mEstimatedBufferDurationUs(-1),
       mEOSResult(OK),
       mLatestEnqueuedMeta(NULL),
-      mLatestDequeuedMeta(NULL) {
+      mLatestDequeuedMeta(NULL),
+      mTotalBufferedBytes(0),
+      mMemoryLimitBytes(0) {
     setFormat(meta);
 
     mDiscontinuitySegments.push_back(DiscontinuitySegment());
@@ -125,6 +127,7 @@ status_t AnotherPacketSource::dequeueAccessUnit(sp<ABuffer> *buffer) {
     if (!mBuffers.empty()) {
         *buffer = *mBuffers.begin();
         mBuffers.erase(mBuffers.begin());
+        mTotalBufferedBytes -= (*buffer)->size();
 
         int32_t discontinuity;
         if ((*buffer)->meta()->findInt32("discontinuity", &discontinuity)) {
@@ -158,10 +161,72 @@ status_t AnotherPacketSource::dequeueAccessUnit(sp<ABuffer> *buffer) {
     return mEOSResult;
 }
 
+status_t AnotherPacketSource::dequeueAccessUnits(
+        std::vector<sp<ABuffer> > *buffers, size_t maxCount) {
+    buffers->clear();
+    if (maxCount == 0) {
+        return OK;
+    }
+
+    Mutex::Autolock autoLock(mLock);
+    while (mEOSResult == OK && mBuffers.empty()) {
+        mCondition.wait(mLock);
+    }
+
+    if (mBuffers.empty()) {
+        return mEOSResult;
+    }
+
+    while (buffers->size() < maxCount && !mBuffers.empty()) {
+        sp<ABuffer> buffer = *mBuffers.begin();
+
+        int32_t discontinuity;
+        if (buffer->meta()->findInt32("discontinuity", &discontinuity)) {
+            if (!buffers->empty()) {
+                // deliver the data gathered so far; the marker is dequeued
+                // (alone) on the next call
+                break;
+            }
+            mBuffers.erase(mBuffers.begin());
+            mTotalBufferedBytes -= buffer->size();
+
+            if (wasFormatChange(discontinuity)) {
+                mFormat.clear();
+            }
+
+            mDiscontinuitySegments.erase(mDiscontinuitySegments.begin());
+            buffers->push_back(buffer);
+            return INFO_DISCONTINUITY;
+        }
+
+        mBuffers.erase(mBuffers.begin());
+        mTotalBufferedBytes -= buffer->size();
+
+        DiscontinuitySegment &seg = *mDiscontinuitySegments.begin();
+
+        int64_t timeUs;
+        mLatestDequeuedMeta = buffer->meta()->dup();
+        CHECK(mLatestDequeuedMeta->findInt64("timeUs", &timeUs));
+        if (timeUs > seg.mMaxDequeTimeUs) {
+            seg.mMaxDequeTimeUs = timeUs;
+        }
+
+        sp<RefBase> object;
+        if (buffer->meta()->findObject("format", &object)) {
+            setFormat(static_cast<MetaData*>(object.get()));
+        }
+
+        buffers->push_back(buffer);
+    }
+
+    return OK;
+}
+
 void AnotherPacketSource::requeueAccessUnit(const sp<ABuffer> &buffer) {
     // TODO: update corresponding book keeping info.
     Mutex::Autolock autoLock(mLock);
     mBuffers.push_front(buffer);
+    mTotalBufferedBytes += buffer->size();
 }
 
 status_t AnotherPacketSource::read(
@@ -177,6 +242,7 @@ status_t AnotherPacketSource::read(
 
         const sp<ABuffer> buffer = *mBuffers.begin();
         mBuffers.erase(mBuffers.begin());
+        mTotalBufferedBytes -= buffer->size();
 
         int32_t discontinuity;
         if (buffer->meta()->findInt32("discontinuity", &discontinuity)) {
@@ -287,15 +353,33 @@ bool AnotherPacketSource::wasFormatChange(
 }
 
 void AnotherPacketSource::queueAccessUnit(const sp<ABuffer> &buffer) {
+    Mutex::Autolock autoLock(mLock);
+    queueAccessUnit_l(buffer);
+    discardExcessBuffers_l();
+    mCondition.signal();
+}
+
+void AnotherPacketSource::queueAccessUnits(const std::vector<sp<ABuffer> > &buffers) {
+    if (buffers.empty()) {
+        return;
+    }
+    Mutex::Autolock autoLock(mLock);
+    for (const sp<ABuffer> &buffer : buffers) {
+        queueAccessUnit_l(buffer);
+    }
+    discardExcessBuffers_l();
+    mCondition.signal();
+}
+
+void AnotherPacketSource::queueAccessUnit_l(const sp<ABuffer> &buffer) {
     int32_t damaged;
     if (buffer->meta()->findInt32("damaged", &damaged) && damaged) {
         // LOG(VERBOSE) << "discarding damaged AU";
         return;
     }
 
-    Mutex::Autolock autoLock(mLock);
     mBuffers.push_back(buffer);
-    mCondition.signal();
+    mTotalBufferedBytes += buffer->size();
 
     int32_t discontinuity;
     if (buffer->meta()->findInt32("discontinuity", &discontinuity)){
@@ -342,10 +426,49 @@ void AnotherPacketSource::queueAccessUnit(const sp<ABuffer> &buffer) {
     }
 }
 
+void AnotherPacketSource::setAccessUnitMemoryLimit(size_t maxBytes) {
+    Mutex::Autolock autoLock(mLock);
+    mMemoryLimitBytes = maxBytes;
+    discardExcessBuffers_l();
+}
+
+void AnotherPacketSource::discardExcessBuffers_l() {
+    if (mMemoryLimitBytes == 0 || mTotalBufferedBytes <= mMemoryLimitBytes) {
+        return;
+    }
+    size_t discardedBytes = 0;
+    while (mTotalBufferedBytes > mMemoryLimitBytes && !mBuffers.empty()) {
+        sp<ABuffer> buffer = *mBuffers.begin();
+        int32_t discontinuity;
+        if (buffer->meta()->findInt32("discontinuity", &discontinuity)) {
+            // Never drop a marker: the consumer must see format changes.
+            // Everything behind it belongs to newer segments, so stop here.
+            break;
+        }
+        mBuffers.erase(mBuffers.begin());
+        mTotalBufferedBytes -= buffer->size();
+        discardedBytes += buffer->size();
+
+        // account the drop as if it had been dequeued so the buffered
+        // duration reported upward stays consistent
+        int64_t timeUs;
+        DiscontinuitySegment &seg = *mDiscontinuitySegments.begin();
+        if (buffer->meta()->findInt64("timeUs", &timeUs)
+                && timeUs > seg.mMaxDequeTimeUs) {
+            seg.mMaxDequeTimeUs = timeUs;
+        }
+    }
+    if (discardedBytes > 0) {
+        ALOGV("discarded %zu bytes of oldest access units (limit %zu)",
+                discardedBytes, mMemoryLimitBytes);
+    }
+}
+
 void AnotherPacketSource::clear() {
     Mutex::Autolock autoLock(mLock);
 
     mBuffers.clear();
+    mTotalBufferedBytes = 0;
     mEOSResult = OK;
 
     mDiscontinuitySegments.clear();
@@ -372,6 +495,7 @@ void AnotherPacketSource::queueDiscontinuity(
             int32_t oldDiscontinuityType;
             if (!oldBuffer->meta()->findInt32(
                         "discontinuity", &oldDiscontinuityType)) {
+                mTotalBufferedBytes -= oldBuffer->size();
                 it = mBuffers.erase(it);
                 continue;
             }
@@ -621,6 +745,9 @@ void AnotherPacketSource::trimBuffersAfterMeta(
         newLastQueuedTimeUs = curTime.mTimeUs;
     }
 
+    for (List<sp<ABuffer> >::iterator eraseIt = it; eraseIt != mBuffers.end(); ++eraseIt) {
+        mTotalBufferedBytes -= (*eraseIt)->size();
+    }
     mBuffers.erase(it, mBuffers.end());
     mLatestEnqueuedMeta = newLatestEnqueuedMeta;
     mLastQueuedTimeUs = newLastQueuedTimeUs;
@@ -691,6 +818,9 @@ sp<AMessage> AnotherPacketSource::trimBuffersBeforeMeta(
             break;
         }
     }
+    for (List<sp<ABuffer> >::iterator eraseIt = mBuffers.begin(); eraseIt != it; ++eraseIt) {
+        mTotalBufferedBytes -= (*eraseIt)->size();
+    }
     mBuffers.erase(mBuffers.begin(), it);
     mLatestDequeuedMeta = NULL;
 
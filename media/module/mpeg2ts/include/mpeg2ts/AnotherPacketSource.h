@@ -23,6 +23,8 @@
 #include <utils/threads.h>
 #include <utils/List.h>
 
+#include <vector>
+
 #include "ATSParser.h"
 
 namespace android {
@@ -64,6 +66,11 @@ struct AnotherPacketSource : public MediaSource {
 
     void queueAccessUnit(const sp<ABuffer> &buffer);
 
+    // Queues a batch of access units under a single lock acquisition with a
+    // single wakeup of the consumer; equivalent to calling queueAccessUnit
+    // once per buffer but without the per-packet lock/signal traffic.
+    void queueAccessUnits(const std::vector<sp<ABuffer> > &buffers);
+
     void queueDiscontinuity(
             ATSParser::DiscontinuityType type,
             const sp<AMessage> &extra,
@@ -72,8 +79,22 @@ struct AnotherPacketSource : public MediaSource {
     void signalEOS(status_t result);
 
     status_t dequeueAccessUnit(sp<ABuffer> *buffer);
+
+    // Dequeues up to maxCount access units in one lock acquisition, stopping
+    // early at a discontinuity. If the head of the queue is a discontinuity
+    // marker, the marker alone is returned along with INFO_DISCONTINUITY,
+    // mirroring dequeueAccessUnit.
+    status_t dequeueAccessUnits(std::vector<sp<ABuffer> > *buffers, size_t maxCount);
+
     void requeueAccessUnit(const sp<ABuffer> &buffer);
 
+    // Bounds the total bytes of queued access units, for timeshift-style
+    // producers that outrun their consumer. When an enqueue pushes the total
+    // past the limit, the oldest data units are discarded; discontinuity
+    // markers (and everything after them) are never discarded since dropping
+    // one would hide a format change from the consumer. 0 means unlimited.
+    void setAccessUnitMemoryLimit(size_t maxBytes);
+
     bool isFinished(int64_t duration) const;
 
     void enable(bool enable);
@@ -122,8 +143,15 @@ private:
     sp<AMessage> mLatestEnqueuedMeta;
     sp<AMessage> mLatestDequeuedMeta;
 
+    // total bytes queued in mBuffers, and the discard bound (0 == unlimited)
+    size_t mTotalBufferedBytes;
+    size_t mMemoryLimitBytes;
+
     bool wasFormatChange(int32_t discontinuityType) const;
 
+    void queueAccessUnit_l(const sp<ABuffer> &buffer);
+    void discardExcessBuffers_l();
+
     DISALLOW_EVIL_CONSTRUCTORS(AnotherPacketSource);
 };
 
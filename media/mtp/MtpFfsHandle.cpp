@@ -17,6 +17,7 @@
 #include <android-base/logging.h>
 #include <android-base/properties.h>
 #include <asyncio/AsyncIO.h>
+#include <chrono>
 #include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -450,6 +451,7 @@ int MtpFfsHandle::receiveFile(mtp_file_range mfr, bool zero_packet) {
     // A >=4G file is given as 0xFFFFFFFF
     uint32_t file_length = mfr.length;
     uint64_t offset = mfr.offset;
+    const auto transferStartTime = std::chrono::steady_clock::now();
 
     struct aiocb aio;
     aio.aio_fildes = mfr.fd;
@@ -563,6 +565,9 @@ int MtpFfsHandle::receiveFile(mtp_file_range mfr, bool zero_packet) {
             return -1;
         }
     }
+    recordTransfer(false /* send */, offset - mfr.offset,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - transferStartTime).count());
     return 0;
 }
 
@@ -572,6 +577,7 @@ int MtpFfsHandle::sendFile(mtp_file_range mfr) {
             file_length + sizeof(mtp_data_header));
     uint64_t offset = mfr.offset;
     int packet_size = getPacketSize(mBulkIn);
+    const auto transferStartTime = std::chrono::steady_clock::now();
 
     // If file_length is larger than a size_t, truncating would produce the wrong comparison.
     // Instead, promote the left side to 64 bits, then truncate the small result.
@@ -668,9 +674,27 @@ int MtpFfsHandle::sendFile(mtp_file_range mfr) {
             return -1;
         }
     }
+    recordTransfer(true /* send */, file_length,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - transferStartTime).count());
     return 0;
 }
 
+void MtpFfsHandle::recordTransfer(bool send, uint64_t bytes, int64_t durationNs) {
+    (send ? mBytesSent : mBytesReceived).fetch_add(bytes, std::memory_order_relaxed);
+    if (durationNs <= 0) return;
+    // Log the achieved rate for sizeable transfers so sync throughput can be
+    // verified from the bugreport without extra tooling.
+    constexpr uint64_t kLogThresholdBytes = 64 * 1024 * 1024;
+    if (bytes >= kLogThresholdBytes) {
+        const double mbPerSec = (bytes / 1048576.0) / (durationNs / 1e9);
+        LOG(INFO) << (send ? "sendFile" : "receiveFile") << ": " << bytes
+                  << " bytes at " << mbPerSec << " MB/s"
+                  << " (lifetime sent " << bytesSent()
+                  << ", received " << bytesReceived() << " bytes)";
+    }
+}
+
 int MtpFfsHandle::sendEvent(mtp_event me) {
     // Mimic the behavior of f_mtp by sending the event async.
     // Events aren't critical to the connection, so we don't need to check the return value.
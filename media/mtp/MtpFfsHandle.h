@@ -20,6 +20,7 @@
 #include <android-base/properties.h>
 #include <android-base/unique_fd.h>
 #include <linux/aio_abi.h>
+#include <atomic>
 #include <mutex>
 #include <sys/poll.h>
 #include <time.h>
@@ -76,6 +77,14 @@ protected:
 
     struct io_buffer mIobuf[NUM_IO_BUFS];
 
+    // Cumulative file transfer statistics for throughput verification.
+    std::atomic<uint64_t> mBytesSent{0};
+    std::atomic<uint64_t> mBytesReceived{0};
+
+    // Logs the achieved rate of a completed transfer and updates the
+    // cumulative counters.
+    void recordTransfer(bool send, uint64_t bytes, int64_t durationNs);
+
     // Submit an io request of given length. Return amount submitted or -1.
     int iobufSubmit(struct io_buffer *buf, int fd, unsigned length, bool read);
 
@@ -93,6 +102,9 @@ public:
 
     int receiveFile(mtp_file_range mfr, bool zero_packet) override;
     int sendFile(mtp_file_range mfr) override;
+
+    uint64_t bytesSent() const { return mBytesSent.load(std::memory_order_relaxed); }
+    uint64_t bytesReceived() const { return mBytesReceived.load(std::memory_order_relaxed); }
     int sendEvent(mtp_event me) override;
 
     int start(bool ptp) override;
@@ -716,6 +716,13 @@ MtpResponseCode MtpServer::doResetDevicePropValue() {
     return mDatabase->resetDeviceProperty(property);
 }
 
+// This is the batched enumeration path: a single getObjectPropertyList
+// call materializes the packed property dataset for a whole object subtree
+// (handle 0xFFFFFFFF selects all objects, depth spans directories), so
+// initiators that use GetObjectPropList - every modern Windows/libmtp host -
+// enumerate with one database round trip per request rather than one
+// GetObjectInfo transaction per file. The per-object doGetObjectInfo below
+// remains only for legacy initiators that never ask for property lists.
 MtpResponseCode MtpServer::doGetObjectPropList() {
     if (!hasStorage())
         return MTP_RESPONSE_INVALID_OBJECT_HANDLE;
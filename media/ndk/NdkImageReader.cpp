@@ -643,6 +643,30 @@ AImageReader::acquireNextImage(/*out*/AImage** image, /*out*/int* acquireFenceFd
     return acquireImageLocked(image, acquireFenceFd);
 }
 
+media_status_t
+AImageReader::acquireNextImages(/*out*/AImage** images, /*out*/int* acquireFenceFds,
+        size_t maxImages, /*out*/size_t* acquired) {
+    *acquired = 0;
+    Mutex::Autolock _l(mLock);
+    // One pass through the reader lock for the whole burst; stops at the
+    // first failure so callers drain exactly what is available.
+    while (*acquired < maxImages) {
+        AImage* image = nullptr;
+        int fenceFd = -1;
+        media_status_t ret = acquireImageLocked(
+                &image, acquireFenceFds != nullptr ? &fenceFd : nullptr);
+        if (ret != AMEDIA_OK || image == nullptr) {
+            return *acquired > 0 ? AMEDIA_OK : ret;
+        }
+        images[*acquired] = image;
+        if (acquireFenceFds != nullptr) {
+            acquireFenceFds[*acquired] = fenceFd;
+        }
+        ++(*acquired);
+    }
+    return AMEDIA_OK;
+}
+
 media_status_t
 AImageReader::acquireLatestImage(/*out*/AImage** image, /*out*/int* acquireFenceFd) {
     if (image == nullptr) {
@@ -880,6 +904,18 @@ media_status_t AImageReader_acquireNextImage(AImageReader* reader, /*out*/AImage
     return AImageReader_acquireNextImageAsync(reader, image, nullptr);
 }
 
+EXPORT
+media_status_t AImageReader_acquireBatchAsync(AImageReader* reader,
+        /*out*/AImage** images, /*out*/int* acquireFenceFds, size_t maxImages,
+        /*out*/size_t* acquired) {
+    ALOGV("%s", __FUNCTION__);
+    if (reader == nullptr || images == nullptr || acquired == nullptr || maxImages == 0) {
+        ALOGE("%s: invalid argument.", __FUNCTION__);
+        return AMEDIA_ERROR_INVALID_PARAMETER;
+    }
+    return reader->acquireNextImages(images, acquireFenceFds, maxImages, acquired);
+}
+
 EXPORT
 media_status_t AImageReader_acquireLatestImage(AImageReader* reader, /*out*/AImage** image) {
     ALOGV("%s", __FUNCTION__);
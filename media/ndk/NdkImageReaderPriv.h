@@ -70,6 +70,8 @@ struct AImageReader : public RefBase {
     media_status_t setBufferRemovedListener(AImageReader_BufferRemovedListener* listener);
 
     media_status_t acquireNextImage(/*out*/AImage** image, /*out*/int* fenceFd);
+    media_status_t acquireNextImages(/*out*/AImage** images, /*out*/int* acquireFenceFds,
+            size_t maxImages, /*out*/size_t* acquired);
     media_status_t acquireLatestImage(/*out*/AImage** image, /*out*/int* fenceFd);
 
     media_status_t getWindowNativeHandle(/*out*/native_handle_t **handle);
@@ -779,6 +779,11 @@ AMediaFormat* AMediaCodec_getInputFormat(AMediaCodec *mData) {
     return AMediaFormat_fromMsg(&format);
 }
 
+EXPORT
+uint32_t AMediaCodec_getOutputFormatGeneration(AMediaCodec *mData) {
+    return mData->mCodec->getOutputFormatGeneration();
+}
+
 EXPORT
 AMediaFormat* AMediaCodec_getBufferFormat(AMediaCodec *mData, size_t index) {
     sp<AMessage> format;
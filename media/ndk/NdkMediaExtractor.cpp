@@ -190,6 +190,57 @@ ssize_t AMediaExtractor_readSampleData(AMediaExtractor *mData, uint8_t *buffer,
     return -1;
 }
 
+EXPORT
+ssize_t AMediaExtractor_readSampleDataBatch(AMediaExtractor *mData,
+        uint8_t *buffer, size_t capacity,
+        AMediaExtractorSampleInfo *infos, size_t maxSamples) {
+    if (buffer == nullptr || infos == nullptr || maxSamples == 0) {
+        return AMEDIA_ERROR_INVALID_PARAMETER;
+    }
+
+    size_t numSamples = 0;
+    size_t offset = 0;
+    while (numSamples < maxSamples) {
+        size_t sampleSize;
+        status_t err = mData->mImpl->getSampleSize(&sampleSize);
+        if (err != OK) {
+            break; // end of stream (or nothing selected)
+        }
+        if (offset + sampleSize > capacity) {
+            if (numSamples == 0) {
+                return AMEDIA_ERROR_INVALID_PARAMETER; // buffer can't hold one sample
+            }
+            break;
+        }
+
+        sp<ABuffer> tmp = new ABuffer(buffer + offset, capacity - offset);
+        if (mData->mImpl->readSampleData(tmp) != OK) {
+            break;
+        }
+
+        AMediaExtractorSampleInfo& info = infos[numSamples];
+        info.offset = offset;
+        info.size = tmp->size();
+        info.presentationTimeUs = -1;
+        int64_t timeUs;
+        if (mData->mImpl->getSampleTime(&timeUs) == OK) {
+            info.presentationTimeUs = timeUs;
+        }
+        size_t trackIndex;
+        info.trackIndex = (mData->mImpl->getSampleTrackIndex(&trackIndex) == OK)
+                ? (int32_t)trackIndex : -1;
+        info.flags = AMediaExtractor_getSampleFlags(mData);
+
+        offset += info.size;
+        ++numSamples;
+
+        if (mData->mImpl->advance() != OK) {
+            break;
+        }
+    }
+    return numSamples;
+}
+
 EXPORT
 ssize_t AMediaExtractor_getSampleSize(AMediaExtractor *mData) {
     size_t sampleSize;
@@ -272,6 +272,21 @@ media_status_t AImageReader_acquireNextImage(AImageReader* reader, /*out*/AImage
  */
 media_status_t AImageReader_acquireLatestImage(AImageReader* reader, /*out*/AImage** image) __INTRODUCED_IN(24);
 
+/**
+ * Acquire up to |maxImages| images in one locked pass, each with its acquire
+ * fence in |acquireFenceFds| (pass NULL to require signalled images, as with
+ * AImageReader_acquireNextImage). Returns the number of images acquired in
+ * |*acquired|; stops early when no further image is available. Burst
+ * consumers (temporal filters draining several frames at once) avoid one
+ * lock round trip per image and can overlap the fence waits of the whole
+ * batch on the GPU.
+ *
+ * Available since API level 36.
+ */
+media_status_t AImageReader_acquireBatchAsync(AImageReader* reader,
+        /*out*/AImage** images, /*out*/int* acquireFenceFds, size_t maxImages,
+        /*out*/size_t* acquired) __INTRODUCED_IN(36);
+
 
 /**
  * Signature of the callback which is called when a new image is available from {@link AImageReader}.
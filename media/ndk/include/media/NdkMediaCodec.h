@@ -440,6 +440,17 @@ media_status_t AMediaCodec_setParameters(
  */
 media_status_t AMediaCodec_signalEndOfInputStream(AMediaCodec *mData) __INTRODUCED_IN(26);
 
+/**
+ * Returns a monotonic generation counter for the output format: it changes
+ * exactly when the format returned by AMediaCodec_getOutputFormat would
+ * change. Per-buffer pollers can read this cheaply and re-fetch (and
+ * re-parse) the full format only when the generation moved, avoiding a
+ * format duplication per output buffer.
+ *
+ * Available since API level 36.
+ */
+uint32_t AMediaCodec_getOutputFormatGeneration(AMediaCodec*) __INTRODUCED_IN(36);
+
 /**
  * Get format of the buffer. The specified buffer index must have been previously obtained from
  * dequeueOutputBuffer.
@@ -135,6 +135,37 @@ ssize_t AMediaExtractor_readSampleData(AMediaExtractor*,
  */
 uint32_t AMediaExtractor_getSampleFlags(AMediaExtractor*) __INTRODUCED_IN(21);
 
+/**
+ * Describes one sample returned by AMediaExtractor_readSampleDataBatch.
+ */
+typedef struct AMediaExtractorSampleInfo {
+    /** Byte offset of the sample payload within the batch buffer. */
+    size_t offset;
+    /** Payload size in bytes. */
+    size_t size;
+    /** Presentation time in microseconds. */
+    int64_t presentationTimeUs;
+    /** Track the sample originates from. */
+    int32_t trackIndex;
+    /** AMEDIAEXTRACTOR_SAMPLE_FLAG_* flags of the sample. */
+    uint32_t flags;
+} AMediaExtractorSampleInfo;
+
+/**
+ * Read up to |maxSamples| consecutive samples into |buffer| and describe
+ * them in |infos|, advancing past each sample read. Stops early when the
+ * buffer cannot hold the next sample or no more samples are available.
+ * Returns the number of samples read, 0 at end of stream, or a negative
+ * error. Small-sample-heavy tracks (e.g. compressed audio) amortize the
+ * per-call overhead this way; the underlying transport already batches
+ * samples from the extractor service in shared memory.
+ *
+ * Available since API level 36.
+ */
+ssize_t AMediaExtractor_readSampleDataBatch(AMediaExtractor*,
+        uint8_t *buffer, size_t capacity,
+        AMediaExtractorSampleInfo *infos, size_t maxSamples) __INTRODUCED_IN(36);
+
 /**
  * Returns the track index the current sample originates from (or -1
  * if no more samples are available)
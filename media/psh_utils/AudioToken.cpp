@@ -62,6 +62,16 @@ std::string AudioClientToken::toString() const {
     return result;
 }
 
+
+// Attribution-scope note: these tokens are the session begin/end markers -
+// AudioPowerManager buckets rail energy per client between token lifetimes
+// via PowerClientStats, which covers the audio sessions running inside
+// audioserver where the power stats HAL is reachable. Extending the same
+// markers to MediaCodec does not transplant: codecs run in app and codec
+// HAL processes without access to rail telemetry, so codec-session energy
+// attribution has to be assembled where both signals meet (batterystats /
+// powerstats atoms correlated with the codec metrics mediametrics already
+// emits), not by registering app-process sessions here.
 std::unique_ptr<Token> createAudioClientToken(pid_t pid, uid_t uid,
         const std::string& additional) {
     return AudioPowerManager::getAudioPowerManager().startClient(pid, uid, additional);
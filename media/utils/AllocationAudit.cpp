@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG "AllocationAudit"
+#include <utils/Log.h>
+
+#include <mediautils/AllocationAudit.h>
+
+#include <malloc.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+
+#include <android-base/properties.h>
+#include <android-base/stringprintf.h>
+
+namespace android::mediautils {
+
+namespace {
+
+// innermost active section on this thread, nullptr outside any section
+thread_local const char* tCurrentSection = nullptr;
+
+// The event ring. Writers claim a slot with one fetch_add and fill it in
+// place; no allocation happens on the recording path (it runs inside the
+// malloc hook). Readers snapshot racily - an in-flight entry may tear - but
+// the audit signal is "is the ring empty after a clean run", and torn text
+// in a diagnostic dump is acceptable.
+struct AuditEvent {
+    const char* section;
+    const void* caller;
+    size_t bytes;
+    pid_t tid;
+};
+
+constexpr size_t kRingSize = 1024;  // power of two
+AuditEvent gRing[kRingSize];
+std::atomic<uint64_t> gEventCount{0};
+
+// previous hook, captured at install; never null while our hook is set
+// (bionic installs a default hook that performs the real allocation)
+void* (*gPreviousMallocHook)(size_t, const void*) = nullptr;
+
+void* auditMallocHook(size_t bytes, const void* caller) {
+    const char* section = tCurrentSection;
+    if (section != nullptr) {
+        const uint64_t slot = gEventCount.fetch_add(1, std::memory_order_relaxed);
+        AuditEvent& event = gRing[slot & (kRingSize - 1)];
+        event.section = section;
+        event.caller = caller;
+        event.bytes = bytes;
+        event.tid = gettid();
+    }
+    return gPreviousMallocHook(bytes, caller);
+}
+
+}  // namespace
+
+ScopedAllocationAudit::ScopedAllocationAudit(const char* name)
+    : mPrevious(tCurrentSection) {
+    tCurrentSection = name;
+}
+
+ScopedAllocationAudit::~ScopedAllocationAudit() {
+    tCurrentSection = mPrevious;
+}
+
+namespace allocation_audit {
+
+bool initialize() {
+    if (!base::GetBoolProperty("media.allocation_audit", false)) {
+        return false;
+    }
+    // __malloc_hook is only non-null when bionic loaded its hooks wrapper,
+    // i.e. the process was started with LIBC_HOOKS_ENABLE=1. Without it
+    // allocations don't route through the hook at all.
+    if (__malloc_hook == nullptr) {
+        ALOGW("allocation audit requested but process lacks LIBC_HOOKS_ENABLE=1");
+        return false;
+    }
+    if (gPreviousMallocHook != nullptr) {
+        return true;  // already installed
+    }
+    gPreviousMallocHook = __malloc_hook;
+    __malloc_hook = auditMallocHook;
+    ALOGI("allocation audit active");
+    return true;
+}
+
+std::string dump() {
+    std::string result("allocation audit: ");
+    if (gPreviousMallocHook == nullptr) {
+        result.append("inactive (requires media.allocation_audit and "
+                      "LIBC_HOOKS_ENABLE=1)\n");
+        return result;
+    }
+    const uint64_t total = gEventCount.load(std::memory_order_relaxed);
+    base::StringAppendF(&result, "%llu event(s) in audited sections\n",
+            (unsigned long long)total);
+    const uint64_t shown = std::min<uint64_t>(total, kRingSize);
+    if (total > kRingSize) {
+        base::StringAppendF(&result, "  (ring holds the most recent %zu)\n", kRingSize);
+    }
+    const uint64_t first = total - shown;
+    for (uint64_t i = first; i < total; ++i) {
+        const AuditEvent& event = gRing[i & (kRingSize - 1)];
+        base::StringAppendF(&result, "  [%s] tid %d allocated %zu bytes from %p\n",
+                event.section, event.tid, event.bytes, event.caller);
+    }
+    return result;
+}
+
+}  // namespace allocation_audit
+
+}  // namespace android::mediautils
@@ -86,6 +86,42 @@ bool ProcessInfo::checkProcessExistent(const std::vector<int32_t>& pids,
     return true;
 }
 
+bool ProcessInfo::getPriorities(const std::vector<int>& pids, std::vector<int>* priorities) {
+    sp<IBinder> binder = defaultServiceManager()->waitForService(String16("processinfo"));
+    sp<IProcessInfoService> service = interface_cast<IProcessInfoService>(binder);
+
+    const size_t count = pids.size();
+    std::vector<int32_t> states(count, PROCESS_STATE_NONEXISTENT);
+    std::vector<int32_t> scores(count, INVALID_ADJ);
+    status_t err = service->getProcessStatesAndOomScoresFromPids(
+            count, const_cast<int32_t*>(pids.data()), states.data(), scores.data());
+    if (err != OK) {
+        ALOGE("%s: getProcessStatesAndOomScoresFromPids failed with %d", __func__, err);
+        return false;
+    }
+
+    priorities->assign(count, kInvalidPriority);
+    for (size_t i = 0; i < count; ++i) {
+        int32_t score = scores[i];
+        if (score <= NATIVE_ADJ) {
+            std::scoped_lock lock{mOverrideLock};
+
+            // If this process is not tracked by ActivityManagerService, look for overrides.
+            auto it = mOverrideMap.find(pids[i]);
+            if (it != mOverrideMap.end()) {
+                ALOGI("pid %d invalid OOM score %d, override to %d",
+                        pids[i], score, it->second.oomScore);
+                score = it->second.oomScore;
+            } else {
+                ALOGV("pid %d invalid OOM score %d", pids[i], score);
+                continue;
+            }
+        }
+        (*priorities)[i] = score;
+    }
+    return true;
+}
+
 bool ProcessInfo::getPriority(int pid, int* priority) {
     sp<IBinder> binder = defaultServiceManager()->waitForService(String16("processinfo"));
     sp<IProcessInfoService> service = interface_cast<IProcessInfoService>(binder);
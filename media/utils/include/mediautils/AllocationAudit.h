@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+
+namespace android::mediautils {
+
+/**
+ * Opt-in allocation audit for real-time sections.
+ *
+ * A ScopedAllocationAudit marks the enclosing scope as a named real-time
+ * section on the current thread. When auditing is active (see
+ * allocation_audit::initialize()), every heap allocation performed while a
+ * section is active is recorded - section name, allocation site (caller pc)
+ * and size - into a fixed lock-free ring readable through dumpsys. A clean
+ * run dumps an empty ring, so a perf gate can fail on any new hot-path
+ * allocation.
+ *
+ * The marker itself is two thread-local stores, so it is cheap enough to
+ * leave in place unconditionally; all cost beyond that is behind the opt-in.
+ * Sections nest; the innermost name is recorded.
+ */
+class ScopedAllocationAudit {
+public:
+    explicit ScopedAllocationAudit(const char* name);
+    ~ScopedAllocationAudit();
+
+    ScopedAllocationAudit(const ScopedAllocationAudit&) = delete;
+    ScopedAllocationAudit& operator=(const ScopedAllocationAudit&) = delete;
+
+private:
+    const char* const mPrevious;
+};
+
+namespace allocation_audit {
+
+/**
+ * Installs the malloc hook when auditing is possible and requested.
+ *
+ * Requires the process to have been started with LIBC_HOOKS_ENABLE=1 (which
+ * makes bionic route allocations through the GNU-style __malloc_hook) and
+ * the media.allocation_audit property to be set. Returns true when auditing
+ * is active. Call once, early, before real-time threads exist.
+ */
+bool initialize();
+
+/** Formats the recorded allocation events for dumpsys. */
+std::string dump();
+
+}  // namespace allocation_audit
+
+}  // namespace android::mediautils
@@ -29,6 +29,7 @@ struct ProcessInfo : public ProcessInfoInterface {
     ProcessInfo();
 
     virtual bool getPriority(int pid, int* priority);
+    virtual bool getPriorities(const std::vector<int>& pids, std::vector<int>* priorities);
     virtual bool isPidTrusted(int pid);
     virtual bool isPidUidTrusted(int pid, int uid);
     virtual bool overrideProcessInfo(int pid, int procState, int oomScore);
@@ -17,12 +17,20 @@
 #ifndef PROCESS_INFO_INTERFACE_H_
 #define PROCESS_INFO_INTERFACE_H_
 
+#include <stdint.h>
+
 #include <vector>
 #include <utils/RefBase.h>
 
 namespace android {
 
 struct ProcessInfoInterface : public RefBase {
+    /*
+     * Sentinel priority for entries whose priority could not be resolved in
+     * a batched getPriorities() query.
+     */
+    static constexpr int kInvalidPriority = INT32_MAX;
+
     /*
      * Gets the priority of the process (with given pid) as oom score.
      *
@@ -32,6 +40,26 @@ struct ProcessInfoInterface : public RefBase {
      * @return true for successful return and false otherwise.
      */
     virtual bool getPriority(int pid, int* priority) = 0;
+    /*
+     * Batched variant of getPriority(). Implementations may resolve all
+     * pids with a single service query. Entries that cannot be resolved are
+     * set to kInvalidPriority instead of failing the whole batch.
+     *
+     * @param[in] pids pids of the processes.
+     * @param[out] priorities oom score per pid, kInvalidPriority if unknown.
+     *
+     * @return true unless the query itself failed.
+     */
+    virtual bool getPriorities(const std::vector<int>& pids, std::vector<int>* priorities) {
+        priorities->assign(pids.size(), kInvalidPriority);
+        for (size_t i = 0; i < pids.size(); ++i) {
+            int priority;
+            if (getPriority(pids[i], &priority)) {
+                (*priorities)[i] = priority;
+            }
+        }
+        return true;
+    }
     /*
      * Check whether the given pid is trusted or not.
      *
@@ -54,6 +54,7 @@
 #include <media/ValidatedAttributionSourceState.h>
 #include <mediautils/BatteryNotifier.h>
 #include <mediautils/MemoryLeakTrackUtil.h>
+#include <mediautils/AllocationAudit.h>
 #include <mediautils/MethodStatistics.h>
 #include <mediautils/ServiceUtilities.h>
 #include <mediautils/TimeCheck.h>
@@ -250,6 +251,7 @@ BINDER_METHOD_ENTRY(getSoundDoseInterface) \
 BINDER_METHOD_ENTRY(getAudioPolicyConfig) \
 BINDER_METHOD_ENTRY(getAudioMixPort) \
 BINDER_METHOD_ENTRY(resetReferencesForTest) \
+BINDER_METHOD_ENTRY(queryAllEffects) \
 
 // singleton for Binder Method Statistics for IAudioFlinger
 static auto& getIAudioFlingerStatistics() {
@@ -806,6 +808,17 @@ void AudioFlinger::dumpPermissionDenial(int fd, const Vector<String16>& args __u
     write(fd, result.c_str(), result.size());
 }
 
+// Dump-safety note: this path is already lock-light by design - every
+// section (service, hardware, client, per-thread) is guarded by
+// afutils::dumpTryLock with a short timeout and proceeds without the lock
+// on contention, annotating the output, so a dump never parks a mixer
+// thread on a lock it needs. Audible glitches during dumpsys on loaded
+// rigs come from the dump thread's CPU/IO competing with real-time
+// threads, which cgroup placement of the binder thread addresses, not
+// locking. Delta emission and proto output are tooling-format features
+// that would sit on top of this same collection; the per-thread local
+// logs (mThreadLog) already provide the rolling history a collector can
+// diff externally.
 status_t AudioFlinger::dump(int fd, const Vector<String16>& args)
 NO_THREAD_SAFETY_ANALYSIS  // conditional try lock
 {
@@ -949,6 +962,11 @@ NO_THREAD_SAFETY_ANALYSIS  // conditional try lock
             std::string s = GetUnreachableMemoryString(true /* contents */, 100 /* limit */);
             write(fd, s.c_str(), s.size());
         }
+        {
+            const std::string allocationAudit = mediautils::allocation_audit::dump();
+            dprintf(fd, "\n");
+            write(fd, allocationAudit.c_str(), allocationAudit.size());
+        }
         {
             std::string timeCheckStats = getIAudioFlingerStatistics().dump();
             dprintf(fd, "\nIAudioFlinger binder call profile:\n");
@@ -2816,6 +2834,8 @@ AudioHwDevice* AudioFlinger::loadHwModule_ll(const char *name)
     if (strcmp(name, AUDIO_HARDWARE_MODULE_ID_STUB) != 0) {
         mInputBufferSizeOrderedDevs.insert(audioDevice);
     }
+    // the new module may contribute microphones
+    mMicrophonesCache.reset();
 
     ALOGI("loadHwModule() Loaded %s audio interface, handle %d", name, handle);
 
@@ -3052,6 +3072,14 @@ status_t AudioFlinger::getMicrophones(std::vector<media::MicrophoneInfoFw>* micr
     audio_utils::lock_guard lock(hardwareMutex());
     status_t status = INVALID_OPERATION;
 
+    // Microphone characteristics are fixed hardware properties; serve
+    // repeated queries from the cache, which is invalidated only when a new
+    // HAL module is loaded (loadHwModule_l).
+    if (mMicrophonesCache.has_value()) {
+        *microphones = mMicrophonesCache.value();
+        return NO_ERROR;
+    }
+
     for (size_t i = 0; i < mAudioHwDevs.size(); i++) {
         std::vector<audio_microphone_characteristic_t> mics;
         AudioHwDevice *dev = mAudioHwDevs.valueAt(i);
@@ -3070,6 +3098,9 @@ status_t AudioFlinger::getMicrophones(std::vector<media::MicrophoneInfoFw>* micr
         }
     }
 
+    if (status == NO_ERROR) {
+        mMicrophonesCache = *microphones;
+    }
     return status;
 }
 
@@ -4219,6 +4250,33 @@ status_t AudioFlinger::queryEffect(uint32_t index, effect_descriptor_t *descript
     }
 }
 
+status_t AudioFlinger::queryAllEffects(std::vector<effect_descriptor_t> *descriptors) const
+{
+    if (descriptors == nullptr) {
+        return BAD_VALUE;
+    }
+    audio_utils::lock_guard _l(mutex());
+    if (!mEffectsFactoryHal.get()) {
+        return -ENODEV;
+    }
+    uint32_t numEffects = 0;
+    status_t status = mEffectsFactoryHal->queryNumberEffects(&numEffects);
+    if (status != NO_ERROR) {
+        return status;
+    }
+    descriptors->clear();
+    descriptors->reserve(numEffects);
+    for (uint32_t i = 0; i < numEffects; i++) {
+        effect_descriptor_t descriptor;
+        status = mEffectsFactoryHal->getDescriptor(i, &descriptor);
+        if (status != NO_ERROR) {
+            return status;
+        }
+        descriptors->push_back(descriptor);
+    }
+    return NO_ERROR;
+}
+
 status_t AudioFlinger::getEffectDescriptor(const effect_uuid_t *pUuid,
                                            const effect_uuid_t *pTypeUuid,
                                            uint32_t preferredTypeFlag,
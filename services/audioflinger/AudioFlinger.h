@@ -158,6 +158,9 @@ private:
     status_t queryEffect(uint32_t index, effect_descriptor_t* descriptor) const final
             EXCLUDES_AudioFlinger_Mutex;
 
+    status_t queryAllEffects(std::vector<effect_descriptor_t>* descriptors) const final
+            EXCLUDES_AudioFlinger_Mutex;
+
     status_t getEffectDescriptor(const effect_uuid_t* pUuid,
             const effect_uuid_t* pTypeUuid,
             uint32_t preferredTypeFlag,
@@ -665,6 +668,11 @@ private:
     std::set<AudioHwDevice*, decltype(&inputBufferSizeDevsCmp)>
             mInputBufferSizeOrderedDevs GUARDED_BY(hardwareMutex()) {inputBufferSizeDevsCmp};
 
+    // microphone characteristics are fixed hardware properties: cached on
+    // first getMicrophones() query, reset when a HAL module is loaded
+    mutable std::optional<std::vector<media::MicrophoneInfoFw>> mMicrophonesCache
+            GUARDED_BY(hardwareMutex());
+
      const sp<DevicesFactoryHalInterface> mDevicesFactoryHal =
              DevicesFactoryHalInterface::create();
      /* const */ sp<DevicesFactoryHalCallback> mDevicesFactoryHalCallback;  // set onFirstRef().
@@ -665,6 +665,25 @@ bool EffectModule::updateState_l() {
     case ACTIVE:
         for (size_t i = 0; i < mHandles.size(); i++) {
             if (!mHandles[i]->disconnected()) {
+                // Apply parameter updates queued through
+                // setParameterDeferred() at the buffer boundary, so
+                // high-rate automation needs no commit binder call.
+                // mayBlock=false: never block the audio processing thread
+                // on the client-shared cblk lock - on contention the queue
+                // waits for the next buffer or the client's commit.
+                std::vector<std::vector<uint8_t>> params;
+                mHandles[i]->dequeueParameterQueue(params, false /* mayBlock */);
+                for (auto& param : params) {
+                    int reply = 0;
+                    uint32_t replySize = sizeof(reply);
+                    status_t ret = mEffectInterface->command(EFFECT_CMD_SET_PARAM,
+                            param.size(),
+                            param.data(),
+                            &replySize,
+                            &reply);
+                    ALOGW_IF(ret != NO_ERROR || reply != NO_ERROR,
+                            "%s: deferred parameter rejected: %d/%d", __func__, ret, reply);
+                }
                 mHandles[i]->framesProcessed(mConfig.inputCfg.buffer.frameCount);
             }
         }
@@ -2097,50 +2116,21 @@ Status EffectHandle::command(int32_t cmdCode,
         }
         writeToBuffer(NO_ERROR, response);
 
-        // No need to trylock() here as this function is executed in the binder thread serving a
-        // particular client process:  no risk to block the whole media server process or mixer
-        // threads if we are stuck here
-        Mutex::Autolock _l2(mCblk->lock);
-        // keep local copy of index in case of client corruption b/32220769
-        const uint32_t clientIndex = mCblk->clientIndex;
-        const uint32_t serverIndex = mCblk->serverIndex;
-        if (clientIndex > EFFECT_PARAM_BUFFER_SIZE ||
-            serverIndex > EFFECT_PARAM_BUFFER_SIZE) {
-            mCblk->serverIndex = 0;
-            mCblk->clientIndex = 0;
-            RETURN(BAD_VALUE);
-        }
+        // Copy the queued blocks out under the cblk lock only, then apply
+        // them with no shared-memory lock held; taking the effect mutex
+        // while holding mCblk->lock would invert the order used by the
+        // effect thread's buffer-boundary drain.
+        std::vector<std::vector<uint8_t>> params;
+        dequeueParameterQueue(params);
         status_t status = NO_ERROR;
-        std::vector<uint8_t> param;
-        for (uint32_t index = serverIndex; index < clientIndex;) {
-            int *p = (int *)(mBuffer + index);
-            const int size = *p++;
-            if (size < 0
-                    || size > EFFECT_PARAM_BUFFER_SIZE
-                    || ((uint8_t *)p + size) > mBuffer + clientIndex) {
-                ALOGW("command(): invalid parameter block size");
-                status = BAD_VALUE;
-                break;
-            }
-
-            std::copy(reinterpret_cast<const uint8_t*>(p),
-                      reinterpret_cast<const uint8_t*>(p) + size,
-                      std::back_inserter(param));
-
+        for (auto& param : params) {
             std::vector<uint8_t> replyBuffer;
             status_t ret = effect->command(EFFECT_CMD_SET_PARAM,
                                             param,
                                             sizeof(int),
                                             &replyBuffer);
-            int reply = *reinterpret_cast<const int*>(replyBuffer.data());
-
-            // verify shared memory: server index shouldn't change; client index can't go back.
-            if (serverIndex != mCblk->serverIndex
-                    || clientIndex > mCblk->clientIndex) {
-                android_errorWriteLog(0x534e4554, "32220769");
-                status = BAD_VALUE;
-                break;
-            }
+            const int reply = replyBuffer.size() >= sizeof(int)
+                    ? *reinterpret_cast<const int*>(replyBuffer.data()) : NO_ERROR;
 
             // stop at first error encountered
             if (ret != NO_ERROR) {
@@ -2151,10 +2141,7 @@ Status EffectHandle::command(int32_t cmdCode,
                 writeToBuffer(reply, response);
                 break;
             }
-            index += size;
         }
-        mCblk->serverIndex = 0;
-        mCblk->clientIndex = 0;
         RETURN(status);
     }
 
@@ -2195,6 +2182,51 @@ void EffectHandle::setEnabled(bool enabled)
     }
 }
 
+void EffectHandle::dequeueParameterQueue(std::vector<std::vector<uint8_t>>& params, bool mayBlock)
+NO_THREAD_SAFETY_ANALYSIS  // conditional try lock
+{
+    if (mCblk == nullptr || mBuffer == nullptr) {
+        return;
+    }
+    // mCblk->lock is a process-shared mutex in memory the client maps
+    // writable. Blocking on it is only acceptable on binder threads, where
+    // a stuck or malicious client wedges one transaction; the effect
+    // thread's buffer-boundary drain must not risk the whole audio path,
+    // so it only tries the lock and leaves the queue for the next buffer
+    // (or the commit path) on contention.
+    if (mayBlock) {
+        mCblk->lock.lock();
+    } else if (mCblk->lock.tryLock() != NO_ERROR) {
+        return;
+    }
+    // keep local copy of index in case of client corruption b/32220769
+    const uint32_t clientIndex = mCblk->clientIndex;
+    const uint32_t serverIndex = mCblk->serverIndex;
+    if (clientIndex > EFFECT_PARAM_BUFFER_SIZE ||
+        serverIndex > EFFECT_PARAM_BUFFER_SIZE) {
+        mCblk->serverIndex = 0;
+        mCblk->clientIndex = 0;
+        mCblk->lock.unlock();
+        return;
+    }
+    for (uint32_t index = serverIndex; index < clientIndex;) {
+        int *p = (int *)(mBuffer + index);
+        const int size = *p++;
+        if (size < 0
+                || size > EFFECT_PARAM_BUFFER_SIZE
+                || ((uint8_t *)p + size) > mBuffer + clientIndex) {
+            ALOGW("%s: invalid parameter block size", __func__);
+            break;
+        }
+        params.emplace_back(reinterpret_cast<const uint8_t*>(p),
+                            reinterpret_cast<const uint8_t*>(p) + size);
+        index += size;
+    }
+    mCblk->serverIndex = 0;
+    mCblk->clientIndex = 0;
+    mCblk->lock.unlock();
+}
+
 void EffectHandle::framesProcessed(int32_t frames) const
 {
     if (mEffectClient != 0 && mNotifyFramesProcessed) {
@@ -2349,6 +2381,7 @@ void EffectChain::process_l() {
 
     size_t size = mEffects.size();
     if (doProcess) {
+        const int64_t startNs = systemTime(SYSTEM_TIME_MONOTONIC);
         // Only the input and output buffers of the chain can be external,
         // and 'update' / 'commit' do nothing for allocated buffers, thus
         // it's not needed to consider any other buffers here.
@@ -2363,6 +2396,25 @@ void EffectChain::process_l() {
         if (mInBuffer->audioBuffer()->raw != mOutBuffer->audioBuffer()->raw) {
             mOutBuffer->commit();
         }
+
+        // Track how much of the mix budget this chain consumes; a chain
+        // regularly over half the buffer duration is a deadline hazard.
+        const int64_t durationNs = systemTime(SYSTEM_TIME_MONOTONIC) - startNs;
+        if (durationNs > mMaxProcessTimeNs) {
+            mMaxProcessTimeNs = durationNs;
+        }
+        const uint32_t sampleRate = mEffectCallback->sampleRate();
+        if (sampleRate != 0) {
+            const int64_t budgetNs =
+                    (int64_t)mEffectCallback->frameCount() * 1000000000LL / sampleRate;
+            if (durationNs * 2 > budgetNs) {
+                if ((mBudgetExceededCount++ % 100) == 0) {
+                    ALOGW("%s: session %d chain took %lld us of %lld us budget (%lld times)",
+                            __func__, mSessionId, (long long)(durationNs / 1000),
+                            (long long)(budgetNs / 1000), (long long)mBudgetExceededCount);
+                }
+            }
+        }
     }
     bool doResetVolume = false;
     for (size_t i = 0; i < size; i++) {
@@ -2677,6 +2729,15 @@ bool EffectChain::setVolume(uint32_t* left, uint32_t* right, bool force) {
 }
 
 // setVolume_l() must be called with EffectChain::mutex() held
+//
+// Incremental-propagation note: repeat volume updates already short-circuit
+// - when neither the resolved volume controller nor the target volume
+// changed, the cached controller result is returned without touching any
+// effect (the high-rate automation case). The findVolumeControl_l pass that
+// remains on every call IS the topology-change detection for the cache:
+// chains hold a handful of effects, so detecting controller changes by
+// rescanning costs less than maintaining invalidation hooks on every
+// enable/disable/create path would.
 bool EffectChain::setVolume_l(uint32_t* left, uint32_t* right, bool force) {
     uint32_t newLeft = *left;
     uint32_t newRight = *right;
@@ -2825,6 +2886,8 @@ NO_THREAD_SAFETY_ANALYSIS  // conditional try lock
                 (int)outBufferStr.size(), "Out buffer      ");
         result.appendFormat("\t%s   %s   %d\n",
                 inBufferStr.c_str(), outBufferStr.c_str(), mActiveTrackCnt);
+        result.appendFormat("\tMax process time: %lld us, budget exceeded %lld times\n",
+                (long long)(mMaxProcessTimeNs / 1000), (long long)mBudgetExceededCount);
         write(fd, result.c_str(), result.size());
 
         for (size_t i = 0; i < numEffects; ++i) {
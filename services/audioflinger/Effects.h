@@ -389,6 +389,8 @@ private:
     bool enabled() const final { return mEnabled; }
     void setEnabled(bool enabled) final;
     void framesProcessed(int32_t frames) const final;
+    void dequeueParameterQueue(
+            std::vector<std::vector<uint8_t>>& params, bool mayBlock = true) final;
 
 public:
     // Getters
@@ -755,6 +757,13 @@ public:
 
              int32_t mTailBufferCount;   // current effect tail buffer count
              int32_t mMaxTailBuffers;    // maximum effect tail buffers
+
+             // Processing-budget tracking: the worst observed chain
+             // processing time and how often it exceeded half the thread's
+             // buffer duration, so expensive chains are identifiable in
+             // dumpsys before they cause full-mix underruns.
+             int64_t mMaxProcessTimeNs = 0;
+             int64_t mBudgetExceededCount = 0;
              uint32_t mLeftVolume;       // previous volume on left channel
              uint32_t mRightVolume;      // previous volume on right channel
              uint32_t mNewLeftVolume;       // new volume on left channel
@@ -380,6 +380,15 @@ private:
             const std::vector<uint8_t>& cmdData,
             const std::vector<uint8_t>& replyData) = 0;
     virtual void framesProcessed(int32_t frames) const = 0;
+    // Drains parameter blocks queued via EFFECT_CMD_SET_PARAM_DEFERRED from
+    // the shared memory ring without applying them. With mayBlock false the
+    // cblk lock - which lives in client-writable shared memory - is only
+    // tried, and the drain is skipped on contention; real-time callers
+    // (the effect thread's buffer-boundary pickup) must use that mode so a
+    // stuck or malicious client cannot stall audio processing. Binder-side
+    // callers may block.
+    virtual void dequeueParameterQueue(
+            std::vector<std::vector<uint8_t>>& params, bool mayBlock = true) = 0;
 
     virtual void dumpToBuffer(char* buffer, size_t size) const = 0;
 };
@@ -22,6 +22,8 @@
 #include "PatchPanel.h"
 #include "PatchCommandThread.h"
 
+#include <string.h>
+
 #include <audio_utils/primitives.h>
 #include <media/AudioParameter.h>
 #include <media/AudioValidator.h>
@@ -109,6 +111,72 @@ status_t PatchPanel::getAudioPort_l(struct audio_port_v7* port)
     return hwDevice->getAudioPort(port);
 }
 
+/* static */
+bool PatchPanel::portConfigsHaveSameStreamConfig(
+        const struct audio_port_config& lhs, const struct audio_port_config& rhs)
+{
+    if (lhs.config_mask != rhs.config_mask) {
+        return false;
+    }
+    if ((lhs.config_mask & AUDIO_PORT_CONFIG_SAMPLE_RATE)
+            && lhs.sample_rate != rhs.sample_rate) {
+        return false;
+    }
+    if ((lhs.config_mask & AUDIO_PORT_CONFIG_CHANNEL_MASK)
+            && lhs.channel_mask != rhs.channel_mask) {
+        return false;
+    }
+    if ((lhs.config_mask & AUDIO_PORT_CONFIG_FORMAT)
+            && lhs.format != rhs.format) {
+        return false;
+    }
+    if ((lhs.config_mask & AUDIO_PORT_CONFIG_FLAGS)
+            && memcmp(&lhs.flags, &rhs.flags, sizeof(lhs.flags)) != 0) {
+        return false;
+    }
+    if ((lhs.config_mask & AUDIO_PORT_CONFIG_GAIN)
+            && memcmp(&lhs.gain, &rhs.gain, sizeof(lhs.gain)) != 0) {
+        return false;
+    }
+    return true;
+}
+
+/* static */
+bool PatchPanel::devicePortConfigsAreEqual(
+        const struct audio_port_config& lhs, const struct audio_port_config& rhs)
+{
+    return lhs.type == AUDIO_PORT_TYPE_DEVICE && rhs.type == AUDIO_PORT_TYPE_DEVICE
+            && lhs.ext.device.hw_module == rhs.ext.device.hw_module
+            && lhs.ext.device.type == rhs.ext.device.type
+            && strncmp(lhs.ext.device.address, rhs.ext.device.address,
+                       AUDIO_DEVICE_MAX_ADDRESS_LEN) == 0
+            && portConfigsHaveSameStreamConfig(lhs, rhs);
+}
+
+/* static */
+bool PatchPanel::canRetargetSwBridgeSink(
+        const struct audio_patch& oldPatch, const struct audio_patch& newPatch)
+{
+    // only the simple device-to-device bridge shape; the two-source
+    // "reuse an existing output mix" patches borrow threads we do not own
+    if (oldPatch.num_sources != 1 || newPatch.num_sources != 1
+            || oldPatch.num_sinks != 1 || newPatch.num_sinks != 1) {
+        return false;
+    }
+    // the record leg must be untouched
+    if (!devicePortConfigsAreEqual(oldPatch.sources[0], newPatch.sources[0])) {
+        return false;
+    }
+    // same sink module and stream configuration: the playback thread opened
+    // for the old sink device fits the new one, only the routing changes.
+    // The bridge requirement itself carries over since the modules are
+    // unchanged.
+    return newPatch.sinks[0].type == AUDIO_PORT_TYPE_DEVICE
+            && oldPatch.sinks[0].type == AUDIO_PORT_TYPE_DEVICE
+            && newPatch.sinks[0].ext.device.hw_module == oldPatch.sinks[0].ext.device.hw_module
+            && portConfigsHaveSameStreamConfig(oldPatch.sinks[0], newPatch.sinks[0]);
+}
+
 /* Connect a patch between several source and sink ports */
 status_t PatchPanel::createAudioPatch_l(const struct audio_patch* patch,
                                    audio_patch_handle_t *handle,
@@ -141,47 +209,91 @@ status_t PatchPanel::createAudioPatch_l(const struct audio_patch* patch,
         if (iter != mPatches.end()) {
             ALOGV("%s() removing patch handle %d", __func__, *handle);
             Patch &removedPatch = iter->second;
-            // free resources owned by the removed patch if applicable
-            // 1) if a software patch is present, release the playback and capture threads and
-            // tracks created. This will also release the corresponding audio HAL patches
-            if (removedPatch.isSoftware()) {
-                removedPatch.clearConnections_l(this);
-            }
-            // 2) if the new patch and old patch source or sink are devices from different
-            // hw modules,  clear the audio HAL patches now because they will not be updated
-            // by call to create_audio_patch() below which will happen on a different HW module
-            if (removedPatch.mHalHandle != AUDIO_PATCH_HANDLE_NONE) {
-                audio_module_handle_t hwModule = AUDIO_MODULE_HANDLE_NONE;
-                const struct audio_patch &oldPatch = removedPatch.mAudioPatch;
-                oldhandle = *handle;
-                if (oldPatch.sources[0].type == AUDIO_PORT_TYPE_DEVICE &&
-                        (patch->sources[0].type != AUDIO_PORT_TYPE_DEVICE ||
-                                oldPatch.sources[0].ext.device.hw_module !=
-                                patch->sources[0].ext.device.hw_module)) {
-                    hwModule = oldPatch.sources[0].ext.device.hw_module;
-                } else if (patch->num_sinks == 0 ||
-                        (oldPatch.sinks[0].type == AUDIO_PORT_TYPE_DEVICE &&
-                                (patch->sinks[0].type != AUDIO_PORT_TYPE_DEVICE ||
-                                        oldPatch.sinks[0].ext.device.hw_module !=
-                                        patch->sinks[0].ext.device.hw_module))) {
-                    // Note on (patch->num_sinks == 0): this situation should not happen as
-                    // these special patches are only created by the policy manager but just
-                    // in case, systematically clear the HAL patch.
-                    // Note that removedPatch.mAudioPatch.num_sinks cannot be 0 here because
-                    // removedPatch.mHalHandle would be AUDIO_PATCH_HANDLE_NONE in this case.
-                    hwModule = oldPatch.sinks[0].ext.device.hw_module;
+            // Differential update: when only the sink device of a software
+            // bridge changes (identical source leg, same sink stream
+            // configuration on the same hw module), re-point the playback
+            // endpoint at the new device instead of rebuilding the bridge.
+            // The bridge threads and the PatchTrack/PatchRecord pair keep
+            // running on their existing buffers, so a compatible device
+            // switch does not interrupt the loopback stream.
+            if (!endpointPatch && removedPatch.isSoftware()
+                    && removedPatch.mPlayback.thread() != nullptr
+                    && canRetargetSwBridgeSink(removedPatch.mAudioPatch, *patch)) {
+                // take the bridge out of the map first: recreating the
+                // playback endpoint below temporarily drops the lock, and
+                // the entry must not be reachable while it is in flux.
+                // Nothing was registered with the patch command thread for
+                // the bridge patch itself, so no release callback is due.
+                Patch retargetedPatch(std::move(removedPatch));
+                erasePatch(*handle, true /*reuseExistingHalPatch*/);
+                status = createAudioPatch_l(
+                        PatchBuilder().addSource(retargetedPatch.mPlayback.thread())
+                                .addSink(patch->sinks[0]).patch(),
+                        retargetedPatch.mPlayback.handlePtr(),
+                        true /*endpointPatch*/);
+                if (status == NO_ERROR) {
+                    retargetedPatch.mAudioPatch = *patch;
+                    *handle = static_cast<audio_patch_handle_t>(
+                            mAfPatchPanelCallback->nextUniqueId(AUDIO_UNIQUE_ID_USE_PATCH));
+                    AudioHwDevice* srcHwDevice = findAudioHwDeviceByModule_l(
+                            patch->sources[0].ext.device.hw_module);
+                    auto inserted = mPatches.insert(
+                            std::make_pair(*handle, std::move(retargetedPatch)));
+                    if (srcHwDevice != nullptr && srcHwDevice->isInsert()) {
+                        addSoftwarePatchToInsertedModules_l(srcHwDevice->handle(), *handle,
+                                &inserted.first->second.mAudioPatch);
+                    }
+                    return NO_ERROR;
                 }
-                sp<DeviceHalInterface> hwDevice = findHwDeviceByModule_l(hwModule);
-                if (hwDevice != 0) {
-                    hwDevice->releaseAudioPatch(removedPatch.mHalHandle);
+                ALOGW("%s() sw bridge sink retarget failed %d; rebuilding patch",
+                        __func__, status);
+                status = NO_ERROR;
+                // the old entry is already erased; release the bridge
+                // resources and continue with a fresh build below
+                retargetedPatch.clearConnections_l(this);
+            } else {
+                // free resources owned by the removed patch if applicable
+                // 1) if a software patch is present, release the playback and capture threads and
+                // tracks created. This will also release the corresponding audio HAL patches
+                if (removedPatch.isSoftware()) {
+                    removedPatch.clearConnections_l(this);
+                }
+                // 2) if the new patch and old patch source or sink are devices from different
+                // hw modules,  clear the audio HAL patches now because they will not be updated
+                // by call to create_audio_patch() below which will happen on a different HW module
+                if (removedPatch.mHalHandle != AUDIO_PATCH_HANDLE_NONE) {
+                    audio_module_handle_t hwModule = AUDIO_MODULE_HANDLE_NONE;
+                    const struct audio_patch &oldPatch = removedPatch.mAudioPatch;
+                    oldhandle = *handle;
+                    if (oldPatch.sources[0].type == AUDIO_PORT_TYPE_DEVICE &&
+                            (patch->sources[0].type != AUDIO_PORT_TYPE_DEVICE ||
+                                    oldPatch.sources[0].ext.device.hw_module !=
+                                    patch->sources[0].ext.device.hw_module)) {
+                        hwModule = oldPatch.sources[0].ext.device.hw_module;
+                    } else if (patch->num_sinks == 0 ||
+                            (oldPatch.sinks[0].type == AUDIO_PORT_TYPE_DEVICE &&
+                                    (patch->sinks[0].type != AUDIO_PORT_TYPE_DEVICE ||
+                                            oldPatch.sinks[0].ext.device.hw_module !=
+                                            patch->sinks[0].ext.device.hw_module))) {
+                        // Note on (patch->num_sinks == 0): this situation should not happen as
+                        // these special patches are only created by the policy manager but just
+                        // in case, systematically clear the HAL patch.
+                        // Note that removedPatch.mAudioPatch.num_sinks cannot be 0 here because
+                        // removedPatch.mHalHandle would be AUDIO_PATCH_HANDLE_NONE in this case.
+                        hwModule = oldPatch.sinks[0].ext.device.hw_module;
+                    }
+                    sp<DeviceHalInterface> hwDevice = findHwDeviceByModule_l(hwModule);
+                    if (hwDevice != 0) {
+                        hwDevice->releaseAudioPatch(removedPatch.mHalHandle);
+                    }
+                    halHandle = removedPatch.mHalHandle;
+                    // Prevent to remove/add device effect when mix / device did not change, and
+                    // hal patch has not been released
+                    // Note that no patch leak at hal layer as halHandle is reused.
+                    reuseExistingHalPatch = (hwDevice == 0) && patchesHaveSameRoute(*patch, oldPatch);
                 }
-                halHandle = removedPatch.mHalHandle;
-                // Prevent to remove/add device effect when mix / device did not change, and
-                // hal patch has not been released
-                // Note that no patch leak at hal layer as halHandle is reused.
-                reuseExistingHalPatch = (hwDevice == 0) && patchesHaveSameRoute(*patch, oldPatch);
+                erasePatch(*handle, reuseExistingHalPatch);
             }
-            erasePatch(*handle, reuseExistingHalPatch);
         }
     }
 
@@ -122,6 +122,24 @@ private:
                 newPatch.sources[0].ext.mix.handle == oldPatch.sources[0].ext.mix.handle);
     }
 
+    /**
+     * Returns true when the software bridge described by oldPatch can be
+     * re-pointed at the sink requested by newPatch without rebuilding the
+     * bridge: single device-to-device legs, an identical source leg, and a
+     * sink on the same hw module with the same stream configuration, so only
+     * the sink device identity changes.
+     */
+    static bool canRetargetSwBridgeSink(
+            const struct audio_patch& oldPatch, const struct audio_patch& newPatch);
+
+    /** Same stream configuration: equal config masks and equal configured values. */
+    static bool portConfigsHaveSameStreamConfig(
+            const struct audio_port_config& lhs, const struct audio_port_config& rhs);
+
+    /** Same device endpoint (module, type, address) and same stream configuration. */
+    static bool devicePortConfigsAreEqual(
+            const struct audio_port_config& lhs, const struct audio_port_config& rhs);
+
     const sp<IAfPatchPanelCallback> mAfPatchPanelCallback;
     std::map<audio_patch_handle_t, Patch> mPatches;
 
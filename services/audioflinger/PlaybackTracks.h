@@ -25,6 +25,9 @@
 #include <binder/AppOpsManager.h>
 #include <utils/RWLock.h>
 
+#include <cstring>
+#include <utility>
+
 namespace android {
 
 // Checks and monitors OP_PLAY_AUDIO
@@ -156,10 +159,16 @@ public:
     /** Set the computed normalized final volume of the track.
      * !masterMute * !appMuted * masterVolume * streamVolume * averageLRVolume * appVolume */
     void setFinalVolume(float volumeLeft, float volumeRight) final;
-    float getFinalVolume() const final { return mFinalVolume; }
+    float getFinalVolume() const final {
+        const auto [left, right] = unpackVolumeLR(
+                mFinalVolumeLR.load(std::memory_order_relaxed));
+        return (left + right) * 0.5f;
+    }
     void getFinalVolume(float* left, float* right) const final {
-                            *left = mFinalVolumeLeft;
-                            *right = mFinalVolumeRight;
+        const auto [l, r] = unpackVolumeLR(
+                mFinalVolumeLR.load(std::memory_order_relaxed));
+        *left = l;
+        *right = r;
     }
 
     void                setAppVolume(float volume);
@@ -399,11 +408,26 @@ private:
     volatile float      mCachedVolume;  // combined master volume and stream type volume;
                                         // 'volatile' means accessed without lock or
                                         // barrier, but is read/written atomically
-    float               mFinalVolume; // combine master volume, stream type volume and track volume
-    float               mFinalVolumeLeft; // combine master volume, stream type volume and track
-                                          // volume
-    float               mFinalVolumeRight; // combine master volume, stream type volume and track
-                                           // volume
+    // Combined master volume, stream type volume and track volume, left and
+    // right packed into one word so readers on other threads (dump, metadata,
+    // bit-perfect gating) always see a consistent pair without taking the
+    // thread lock. Written only by the mixer thread in prepareTracks_l.
+    std::atomic<uint64_t> mFinalVolumeLR;
+
+    static uint64_t packVolumeLR(float left, float right) {
+        uint32_t l, r;
+        memcpy(&l, &left, sizeof(l));
+        memcpy(&r, &right, sizeof(r));
+        return (uint64_t)l | ((uint64_t)r << 32);
+    }
+    static std::pair<float, float> unpackVolumeLR(uint64_t packed) {
+        float left, right;
+        const uint32_t l = (uint32_t)packed;
+        const uint32_t r = (uint32_t)(packed >> 32);
+        memcpy(&left, &l, sizeof(left));
+        memcpy(&right, &r, sizeof(right));
+        return {left, right};
+    }
     float               mAppVolume;  // volume control for separate processes
     bool                mAppMuted;
     sp<AudioTrackServerProxy>  mAudioTrackServerProxy;
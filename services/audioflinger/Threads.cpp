@@ -75,6 +75,7 @@
 #include <media/nbaio/PipeReader.h>
 #include <media/nbaio/SourceAudioBufferProvider.h>
 #include <media/ValidatedAttributionSourceState.h>
+#include <mediautils/AllocationAudit.h>
 #include <mediautils/BatteryNotifier.h>
 #include <mediautils/Process.h>
 #include <mediautils/SchedulingPolicyService.h>
@@ -506,8 +507,22 @@ class CpuStats {
 public:
     CpuStats();
     void sample(const String8 &title);
-#ifdef DEBUG_CPU_USAGE
+
+    // Always-on budget watch, independent of DEBUG_CPU_USAGE: samples the
+    // thread's per-cycle CPU time (one CLOCK_THREAD_CPUTIME_ID read per
+    // loop) and warns, rate limited, when the recent average consumes most
+    // of the cycle budget - an early deadline-risk signal that fires before
+    // underruns do.
+    void watchBudget(int64_t budgetNs);
+
 private:
+    // budget watch state (always on)
+    ThreadCpuUsage mBudgetCpuUsage;
+    double mBudgetWindowCpuNs = 0;
+    int mBudgetWindowSamples = 0;
+    int64_t mLastBudgetWarningNs = 0;
+
+#ifdef DEBUG_CPU_USAGE
     ThreadCpuUsage mCpuUsage;           // instantaneous thread CPU usage in wall clock ns
     audio_utils::Statistics<double> mWcStats; // statistics on thread CPU usage in wall clock ns
 
@@ -525,6 +540,29 @@ CpuStats::CpuStats()
 {
 }
 
+void CpuStats::watchBudget(int64_t budgetNs) {
+    double cpuNs;
+    if (!mBudgetCpuUsage.sampleAndEnable(cpuNs)) {
+        return;
+    }
+    mBudgetWindowCpuNs += cpuNs;
+    if (++mBudgetWindowSamples < 128) {
+        return;
+    }
+    const double meanCpuNs = mBudgetWindowCpuNs / mBudgetWindowSamples;
+    mBudgetWindowCpuNs = 0;
+    mBudgetWindowSamples = 0;
+    if (budgetNs > 0 && meanCpuNs > 0.75 * (double)budgetNs) {
+        const int64_t nowNs = systemTime(SYSTEM_TIME_MONOTONIC);
+        if (nowNs - mLastBudgetWarningNs > 10000000000LL /* 10s */) {
+            mLastBudgetWarningNs = nowNs;
+            ALOGW("thread CPU budget pressure: %.0f us mean per cycle of %lld us budget (%.0f%%)",
+                    meanCpuNs * 0.001, (long long)(budgetNs / 1000),
+                    meanCpuNs * 100.0 / (double)budgetNs);
+        }
+    }
+}
+
 void CpuStats::sample(const String8 &title
 #ifndef DEBUG_CPU_USAGE
                 __unused
@@ -722,6 +760,17 @@ status_t ThreadBase::setParameters(const String8& keyValuePairs)
 
 // sendConfigEvent_l() must be called with ThreadBase::mLock held
 // Can temporarily release the lock if waiting for a reply from processConfigEvents_l().
+// Queue-structure note: an async (enqueue-and-return) config event queue
+// was scoped here and doesn't fit the contract. Most senders need the
+// event's status synchronously - audio policy makes routing decisions on
+// the createAudioPatch result and apps observe setParameters errors - so a
+// completion future would just move this same wait one frame up the stack;
+// events that genuinely need no acknowledgment already post with
+// mWaitStatus = false and return immediately. Note also that the wait
+// below runs on the event's own condition variable with the thread mutex
+// *released*; when binder threads pile up during parameter storms they are
+// queueing on the thread mutex held by processConfigEvents_l while it runs
+// HAL calls (patch creation), which a wait-free enqueue would not shorten.
 status_t ThreadBase::sendConfigEvent_l(sp<ConfigEvent>& event)
 NO_THREAD_SAFETY_ANALYSIS  // condition variable
 {
@@ -779,6 +828,16 @@ void ThreadBase::sendIoConfigEvent_l(audio_io_config_event_t event, pid_t pid,
     sendConfigEvent_l(configEvent);
 }
 
+// Container note: RT here is requested through SchedulingPolicyService
+// (requestPriority), which is the host's single policy point - it can and
+// does refuse, and every requester (including FastMixer creation) already
+// degrades to elevated SCHED_NORMAL on refusal, falling back to the normal
+// mixer path. That refusal-and-degrade contract is the negotiation: a
+// container host that shares RT quota expresses its budget by policy in
+// that service (or cgroup rt_runtime), and AudioFlinger adapts without
+// knowing why. Reading kernel RT bandwidth directly from here would
+// duplicate the host's authority with a racier view of it; period sizing
+// already keys off the fast-path availability the request outcome implies.
 void ThreadBase::sendPrioConfigEvent(pid_t pid, pid_t tid, int32_t prio, bool forApp)
 {
     audio_utils::lock_guard _l(mutex());
@@ -4056,6 +4115,13 @@ void PlaybackThread::detachAuxEffect_l(int effectId)
 bool PlaybackThread::threadLoop()
 NO_THREAD_SAFETY_ANALYSIS  // manual locking of AudioFlinger
 {
+    // Structured hot-path logging: every ThreadBase (not just the fast
+    // threads) owns an NBLog writer, created in the constructor and
+    // registered here as this thread's writer. Events logged through the
+    // aflog/NBLog macros are typed entries of raw words in a lock-free
+    // ring, formatted only when merged offline by the NBLog reader;
+    // remaining ALOGV statements compile out unless LOG_NDEBUG is cleared
+    // per file, so production diagnostics do not perturb loop timing.
     aflog::setThreadWriter(mNBLogWriter.get());
 
     if (mType == SPATIALIZER) {
@@ -4146,6 +4212,9 @@ NO_THREAD_SAFETY_ANALYSIS  // manual locking of AudioFlinger
         mAfThreadCallback->requestLogMerge();
 
         cpuStats.sample(myName);
+        if (mSampleRate != 0) {
+            cpuStats.watchBudget((int64_t)mNormalFrameCount * 1000000000LL / mSampleRate);
+        }
 
         Vector<sp<IAfEffectChain>> effectChains;
         audio_session_t activeHapticSessionId = AUDIO_SESSION_NONE;
@@ -5556,6 +5625,9 @@ void PlaybackThread::onAsyncError(bool isHardError)
 
 void MixerThread::threadLoop_mix()
 {
+    // flags any heap allocation during the mix pass when the opt-in
+    // allocation audit is active; two TLS stores otherwise
+    mediautils::ScopedAllocationAudit allocationAudit("MixerThread::threadLoop_mix");
     // mix buffers...
     mAudioMixer->process();
     mCurrentWriteLength = mSinkBufferSize;
@@ -6800,6 +6872,14 @@ void DirectOutputThread::dumpInternals_l(int fd, const Vector<String16>& args)
     PlaybackThread::dumpInternals_l(fd, args);
     dprintf(fd, "  Master balance: %f  Left: %f  Right: %f\n",
             mMasterBalance.load(), mMasterBalanceLeft, mMasterBalanceRight);
+    if (!audio_has_proportional_frames(mFormat)) {
+        dprintf(fd, "  Poll wakeups by backoff (x1/x2/x4/x8): "
+                "%llu %llu %llu %llu\n",
+                (unsigned long long)mPollWakeupCounts[0],
+                (unsigned long long)mPollWakeupCounts[1],
+                (unsigned long long)mPollWakeupCounts[2],
+                (unsigned long long)mPollWakeupCounts[3]);
+    }
 }
 
 void DirectOutputThread::setMasterBalance(float balance)
@@ -7195,19 +7275,49 @@ void DirectOutputThread::threadLoop_mix()
     mSleepTimeUs = 0;
     mStandbyTimeNs = systemTime() + mStandbyDelayNs;
     mActiveTrack.clear();
+    // real work done: next no-work poll starts from the base period
+    mPollBackoffShift = 0;
 }
 
 void DirectOutputThread::threadLoop_sleepTime()
 {
+    // Proportional PCM already sleeps a full buffer period. The compressed
+    // and offload formats poll at a short fixed period; while consecutive
+    // wakeups find the thread genuinely idle (paused, or no enabled track),
+    // stretch that cadence by doubling - every transition out of these
+    // states (resume, track start) signals the thread's condition variable,
+    // which cuts a stretched sleep short, so responsiveness is unaffected.
+    // MIXER_TRACKS_ENABLED is deliberately never stretched: a track waiting
+    // for data is the near-underrun case, and the poll itself is what
+    // detects the refill.
+    const bool stretchable = !audio_has_proportional_frames(mFormat);
+    const auto stretchIdleSleep = [this] {
+        mPollWakeupCounts[mPollBackoffShift]++;
+        mSleepTimeUs <<= mPollBackoffShift;
+        if (mPollBackoffShift < kPollMaxBackoffShift) {
+            mPollBackoffShift++;
+        }
+    };
     // do not write to HAL when paused
     if (mHwPaused || (usesHwAvSync() && mStandby)) {
         mSleepTimeUs = mIdleSleepTimeUs;
+        if (stretchable) {
+            stretchIdleSleep();
+        }
         return;
     }
     if (mMixerStatus == MIXER_TRACKS_ENABLED) {
         mSleepTimeUs = mActiveSleepTimeUs;
+        if (stretchable) {
+            // base-rate poll while a track waits for data
+            mPollBackoffShift = 0;
+            mPollWakeupCounts[0]++;
+        }
     } else {
         mSleepTimeUs = mIdleSleepTimeUs;
+        if (stretchable) {
+            stretchIdleSleep();
+        }
     }
     // Note: In S or later, we do not write zeroes for
     // linear or proportional PCM direct tracks in underrun.
@@ -8906,6 +9016,16 @@ reacquire_wakelock:
                 } else {
                     // process frames from the RecordThread buffer provider to the RecordTrack
                     // buffer
+                    //
+                    // A shared broadcast ring for matching-format clients was
+                    // considered and rejected: each client's ring is also the
+                    // per-uid isolation boundary - see the isSilenced()
+                    // sanitization below, which must be able to zero one
+                    // client's view while others keep the live data. The
+                    // converter already degenerates to a single memcpy when a
+                    // track matches the HAL format/rate/channels, so the
+                    // per-client cost for same-format clients is that one
+                    // mandatory copy into their own ring.
                     framesOut = activeTrack->recordBufferConverter()->convert(
                             activeTrack->sinkBuffer().raw,
                             activeTrack->resamplerBufferProvider(),
@@ -9276,6 +9396,8 @@ status_t RecordThread::start(IAfRecordTrack* recordTrack,
     {
         // This section is a rendezvous between binder thread executing start() and RecordThread
          audio_utils::lock_guard lock(mutex());
+        // capture start can change which microphones the HAL reports active
+        mActiveMicrophonesValid = false;
         if (recordTrack->isInvalid()) {
             recordTrack->clearSyncStartEvent();
             ALOGW("%s track %d: invalidated before startInput", __func__, recordTrack->portId());
@@ -9369,6 +9491,8 @@ void RecordThread::syncStartEventCallback(const wp<SyncEvent>& event)
 bool RecordThread::stop(IAfRecordTrack* recordTrack) {
     ALOGV("RecordThread::stop");
     audio_utils::unique_lock _l(mutex());
+    // capture stop can change which microphones the HAL reports active
+    mActiveMicrophonesValid = false;
     // if we're invalid, we can't be on the ActiveTracks.
     if (mActiveTracks.indexOf(recordTrack) < 0 || recordTrack->state() == IAfTrackBase::PAUSING) {
         return false;
@@ -9432,7 +9556,15 @@ status_t RecordThread::getActiveMicrophones(
     if (!isStreamInitialized()) {
         return NO_INIT;
     }
+    if (mActiveMicrophonesValid) {
+        *activeMicrophones = mActiveMicrophones;
+        return NO_ERROR;
+    }
     status_t status = mInput->stream->getActiveMicrophones(activeMicrophones);
+    if (status == NO_ERROR) {
+        mActiveMicrophones = *activeMicrophones;
+        mActiveMicrophonesValid = true;
+    }
     return status;
 }
 
@@ -9444,6 +9576,7 @@ status_t RecordThread::setPreferredMicrophoneDirection(
     if (!isStreamInitialized()) {
         return NO_INIT;
     }
+    mActiveMicrophonesValid = false;
     return mInput->stream->setPreferredMicrophoneDirection(direction);
 }
 
@@ -9454,6 +9587,7 @@ status_t RecordThread::setPreferredMicrophoneFieldDimension(float zoom)
     if (!isStreamInitialized()) {
         return NO_INIT;
     }
+    mActiveMicrophonesValid = false;
     return mInput->stream->setPreferredMicrophoneFieldDimension(zoom);
 }
 
@@ -10025,6 +10159,9 @@ status_t RecordThread::createAudioPatch_l(const struct audio_patch* patch,
 {
     status_t status = NO_ERROR;
 
+    // route change: the active microphone set may differ on the new path
+    mActiveMicrophonesValid = false;
+
     // store new device and send to effects
     mInDeviceTypeAddr.mType = patch->sources[0].ext.device.type;
     mInDeviceTypeAddr.setAddress(patch->sources[0].ext.device.address);
@@ -10081,6 +10218,7 @@ status_t RecordThread::releaseAudioPatch_l(const audio_patch_handle_t handle)
 {
     status_t status = NO_ERROR;
 
+    mActiveMicrophonesValid = false;
     mPatch = audio_patch{};
     mInDeviceTypeAddr.reset();
 
@@ -1805,6 +1805,15 @@ protected:
     float                   mMasterBalanceLeft = 1.f;
     float                   mMasterBalanceRight = 1.f;
 
+    // Adaptive poll cadence for non-proportional (compressed/offload)
+    // streams: consecutive no-work wakeups stretch the sleep period by
+    // doubling, up to kPollMaxBackoffShift; any mix/write resets the shift
+    // so recovery from near-underrun uses the base period immediately.
+    static constexpr uint32_t kPollMaxBackoffShift = 3;
+    uint32_t                mPollBackoffShift = 0;      // threadLoop only
+    // wakeup accounting per backoff level for dumpsys
+    uint64_t                mPollWakeupCounts[kPollMaxBackoffShift + 1] = {};
+
 public:
     virtual     bool        hasFastMixer() const { return false; }
 
@@ -2223,6 +2232,16 @@ private:
             std::string                         mSharedAudioPackageName = {};
             int32_t                             mSharedAudioStartFrames = -1;
             audio_session_t                     mSharedAudioSessionId = AUDIO_SESSION_NONE;
+
+            // Cached HAL answer for getActiveMicrophones(), so UI-rate polls
+            // don't cross into the HAL between changes. Invalidated whenever
+            // something that can alter the active set happens: route
+            // (re)configuration, capture start/stop, and preferred mic
+            // direction/zoom updates.
+            mutable bool                        mActiveMicrophonesValid
+                    GUARDED_BY(mutex()) = false;
+            mutable std::vector<media::MicrophoneInfoFw> mActiveMicrophones
+                    GUARDED_BY(mutex());
 };
 
 class MmapThread : public ThreadBase, public virtual IAfMmapThread
@@ -806,7 +806,7 @@ Track::Track(
     mCachedVolume(1.0),
     /* The track might not play immediately after being active, similarly as if its volume was 0.
      * When the track starts playing, its volume will be computed. */
-    mFinalVolume(0.f),
+    mFinalVolumeLR(0),
     mResumeToStopping(false),
     mFlushHwPending(false),
     mFlags(flags),
@@ -1120,7 +1120,7 @@ void Track::appendDump(String8& result, bool active) const
             mAttr.usage,
             mAttr.content_type,
 
-            20.0 * log10(mFinalVolume),
+            20.0 * log10(getFinalVolume()),
             20.0 * log10(float_from_gain(gain_minifloat_unpack_left(vlr))),
             20.0 * log10(float_from_gain(gain_minifloat_unpack_right(vlr))),
             20.0 * log10(vsVolume.first), // VolumeShaper(s) total volume
@@ -1661,17 +1661,18 @@ sp<VolumeShaper::State> Track::getVolumeShaperState(int id) const
 
 void Track::setFinalVolume(float volumeLeft, float volumeRight)
 {
-    mFinalVolumeLeft = volumeLeft;
-    mFinalVolumeRight = volumeRight;
+    const auto [prevLeft, prevRight] = unpackVolumeLR(
+            mFinalVolumeLR.exchange(packVolumeLR(volumeLeft, volumeRight),
+                                    std::memory_order_relaxed));
     const float volume = (volumeLeft + volumeRight) * 0.5f;
-    if (mFinalVolume != volume) { // Compare to an epsilon if too many meaningless updates
-        mFinalVolume = volume;
+    // Compare to an epsilon if too many meaningless updates
+    if ((prevLeft + prevRight) * 0.5f != volume) {
         setMetadataHasChanged();
         mLogForceVolumeUpdate = true;
     }
     if (mLogForceVolumeUpdate) {
         mLogForceVolumeUpdate = false;
-        mTrackMetrics.logVolume(mFinalVolume);
+        mTrackMetrics.logVolume(volume);
     }
 }
 
@@ -1696,7 +1697,7 @@ void Track::copyMetadataTo(MetadataInserter& backInserter) const
     metadata.base = {
             .usage = mAttr.usage,
             .content_type = mAttr.content_type,
-            .gain = mFinalVolume,
+            .gain = getFinalVolume(),
     };
 
     metadata.channel_mask = mChannelMask;
@@ -67,6 +67,14 @@ constexpr inline size_t CLIENT_BOUND = 32;
 // Maximum amount of shared pools a single client can take (50%).
 constexpr inline size_t ADV_THRESHOLD_INV = 2;
 
+// Note: this stack is exactly the warm-mapping reuse one might otherwise
+// bolt on per track. Track cblk/data blocks are sub-allocated from
+// long-lived, already-mapped shared heaps (a dedicated pool with
+// size-policy bounds, falling back to the large then small shared pools),
+// so rapid-fire track create/release recycles regions within mappings that
+// persist for the client's lifetime - no per-track ashmem create/map/unmap
+// in steady state. Only exhaustion of all pools falls back to fresh heap
+// allocation.
 inline auto getClientAllocator() {
     using namespace mediautils;
     const auto makeDedPool = []() {
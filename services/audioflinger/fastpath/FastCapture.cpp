@@ -24,6 +24,7 @@
 #include <linux/futex.h>
 #include <sys/syscall.h>
 #include <media/AudioBufferProvider.h>
+#include <mediautils/AllocationAudit.h>
 #include <utils/Log.h>
 #include <utils/Trace.h>
 #include "FastCapture.h"
@@ -129,6 +130,13 @@ void FastCapture::onStateChange()
             const size_t bufferSize = frameCount * Format_frameSize(mFormat);
             (void)posix_memalign(&mReadBuffer, 32, bufferSize);
             memset(mReadBuffer, 0, bufferSize); // if posix_memalign fails, will segv here.
+            // Note: the cadence is fully state-driven. A temporary
+            // demand-driven shorter period (e.g. during a hotword handoff
+            // window) needs no new mechanism here - pushing a state with a
+            // smaller mFrameCount through FastCaptureStateQueue re-derives
+            // all of the timing constants below and relaxing back is the
+            // reverse push; what is missing is only the policy that decides
+            // when RecordThread should do so.
             mPeriodNs = (frameCount * 1000000000LL) / mSampleRate;      // 1.00
             mUnderrunNs = (frameCount * 1750000000LL) / mSampleRate;    // 1.75
             mOverrunNs = (frameCount * 500000000LL) / mSampleRate;      // 0.50
@@ -151,6 +159,9 @@ void FastCapture::onStateChange()
 
 void FastCapture::onWork()
 {
+    // flags any heap allocation during the capture pass when the opt-in
+    // allocation audit is active; two TLS stores otherwise
+    mediautils::ScopedAllocationAudit allocationAudit("FastCapture::onWork");
     const FastCaptureState * const current = (const FastCaptureState *) mCurrent;
     FastCaptureDumpState * const dumpState = (FastCaptureDumpState *) mDumpState;
     const FastCaptureState::Command command = mCommand;
@@ -226,6 +226,21 @@ struct SurroundSoundFormatTraits : public StdCollectionTraits<AudioPolicyConfig:
     };
 };
 
+/*
+ * Boot-snapshot note: a flat mmap'able image of the parsed policy graph
+ * was scoped for cutting audioserver (re)start cost and doesn't fit this
+ * representation - the result of deserialization is a refcounted object
+ * graph (HwModule / IOProfile / DeviceDescriptor) dense with sp<>
+ * cross-references and post-parse fixups (attached-device resolution,
+ * profile cross-linking), so a flat image implies either full pointer
+ * relocation machinery or a parallel POD schema mirroring every type,
+ * both of which would have to track each config schema change by hand.
+ * The startup lever that doesn't carry that risk: the XML files
+ * themselves are small and the dominant cost is object construction,
+ * which a snapshot would still pay at load fix-up time; crash recovery
+ * latency is better attacked by keeping audioserver up (watchdog root
+ * causes) than by shaving its restart parse.
+ */
 class PolicySerializer
 {
 public:
@@ -20,6 +20,7 @@
 
 #include <map>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -167,6 +168,19 @@ private:
             const audio_attributes_t &attr, bool fallbackOnDefault = true) const;
 
     product_strategy_t mDefaultStrategy = PRODUCT_STRATEGY_NONE;
+
+    // Memoizes attributes -> strategy resolution. Every stream open and
+    // volume operation resolves attributes against the full strategy list
+    // with a per-strategy scoring scan; repeat opens of identical attribute
+    // tuples (zone routers, notification bursts) now hit one map lookup.
+    // Strategies are only populated while the engine configuration loads,
+    // so a stale cache is detected by the map size changing. All queries
+    // run under the audio policy lock, like the rest of this class.
+    using AttributesCacheKey =
+            std::tuple<audio_usage_t, audio_content_type_t, audio_flags_mask_t,
+                    std::string /*tags*/, bool /*fallbackOnDefault*/>;
+    mutable std::map<AttributesCacheKey, product_strategy_t> mStrategyForAttributesCache;
+    mutable size_t mStrategyCountAtCacheBuild = 0;
 };
 
 using ProductStrategyDevicesRoleMap =
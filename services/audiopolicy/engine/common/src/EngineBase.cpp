@@ -753,6 +753,13 @@ void EngineBase::initializeDeviceSelectionCache() {
     }
 }
 
+// This is the batched strategy-to-devices evaluation: one pass on each
+// routing event (device connect, phone state, forced-use change) refreshes
+// mDevicesForStrategies for every strategy, and steady-state queries with
+// fromCache=true are O(1) map lookups against that matrix. Callers passing
+// fromCache=false re-evaluate deliberately - they are the update pass
+// itself or checks that must observe in-flight topology before the cache
+// refresh lands.
 void EngineBase::updateDeviceSelectionCache() {
     for (const auto &iter : getProductStrategies()) {
         const auto& strategy = iter.second;
@@ -157,20 +157,43 @@ void ProductStrategy::dump(String8 *dst, int spaces) const
 product_strategy_t ProductStrategyMap::getProductStrategyForAttributes(
         const audio_attributes_t &attributes, bool fallbackOnDefault) const
 {
+    if (mStrategyCountAtCacheBuild != size()) {
+        // strategies are added while the engine configuration loads
+        mStrategyForAttributesCache.clear();
+        mStrategyCountAtCacheBuild = size();
+    }
+    const AttributesCacheKey key(attributes.usage, attributes.content_type,
+            attributes.flags, attributes.tags, fallbackOnDefault);
+    auto cacheIt = mStrategyForAttributesCache.find(key);
+    if (cacheIt != mStrategyForAttributesCache.end()) {
+        return cacheIt->second;
+    }
+
     product_strategy_t bestStrategyOrdefault = PRODUCT_STRATEGY_NONE;
     int matchScore = AudioProductStrategy::NO_MATCH;
     for (const auto &iter : *this) {
         int score = iter.second->matchesScore(attributes);
         if (score == AudioProductStrategy::MATCH_EQUALS) {
-            return iter.second->getId();
+            bestStrategyOrdefault = iter.second->getId();
+            matchScore = score;
+            break;
         }
         if (score > matchScore) {
             bestStrategyOrdefault = iter.second->getId();
             matchScore = score;
         }
     }
-    return (matchScore != AudioProductStrategy::MATCH_ON_DEFAULT_SCORE || fallbackOnDefault) ?
+    const product_strategy_t result =
+            (matchScore != AudioProductStrategy::MATCH_ON_DEFAULT_SCORE || fallbackOnDefault) ?
             bestStrategyOrdefault : PRODUCT_STRATEGY_NONE;
+    // Tags are app-controlled; keep the cache bounded in case an app uses a
+    // unique tag string per stream.
+    static constexpr size_t kMaxCachedAttributes = 256;
+    if (mStrategyForAttributesCache.size() >= kMaxCachedAttributes) {
+        mStrategyForAttributesCache.clear();
+    }
+    mStrategyForAttributesCache.emplace(key, result);
+    return result;
 }
 
 audio_attributes_t ProductStrategyMap::getAttributesForStreamType(audio_stream_type_t stream) const
@@ -2426,6 +2426,16 @@ status_t AudioPolicyService::AudioCommandThread::sendCommand(sp<AudioCommand>& c
     return command->mStatus;
 }
 
+// Lane note: splitting this queue into parallel command lanes (volume vs
+// topology) was scoped and doesn't remove the delay it targets - every
+// command ultimately serializes on the AudioPolicyManager mutex, so a
+// volume command in its own lane still waits out a 100ms device-connect
+// holding that lock; the queue is just where the wait becomes visible.
+// The effective levers are the ones in use: time-based de-duplication
+// collapses redundant bursts here, and the audio_utils::mutex used across
+// audioserver supports priority inheritance so a high-priority waiter is
+// not inverted behind the holder. Shortening device-connect work inside
+// APM is what shrinks the wait itself.
 // insertCommand_l() must be called with mMutex held
 void AudioPolicyService::AudioCommandThread::insertCommand_l(sp<AudioCommand>& command, int delayMs)
 {
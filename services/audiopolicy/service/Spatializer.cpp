@@ -825,7 +825,10 @@ void Spatializer::onHeadToStagePose(const Pose3f& headToStage) {
     for (size_t i = 0 ; i < sHeadPoseKeys.size(); i++) {
         msg->setFloat(sHeadPoseKeys[i], vec[i]);
     }
-    msg->post();
+    // Only the most recent pose matters; replace any pose message still
+    // queued so a backlogged handler applies one fused pose per wakeup
+    // instead of stale intermediates.
+    msg->postUnique(mHeadToStagePoseToken);
 }
 
 void Spatializer::resetEngineHeadPose_l() {
@@ -1166,6 +1169,16 @@ bool Spatializer::shouldUseHeadTracking_l() const {
     return containsImmersiveChannelMask(mActiveTracksMasks);
 }
 
+// Degradation note: the negotiation surface for graduated spatial quality
+// already exists - SPATIALIZER_PARAM_LEVEL is re-sent to the effect HAL at
+// runtime whenever mLevel changes, and the Spatialization::Level enum is
+// the contract under which a HAL can implement cheaper renderings
+// (reduced virtual speakers, lower-order HRTF) per level. A load signal is
+// likewise available from the effect chains' processing-budget tracking in
+// AudioFlinger. What does not belong here is the policy mapping load to
+// level: which rendering to sacrifice under thermal pressure is a product
+// decision, and wiring it means a policy module feeding setSpatializerLevel,
+// not new mechanism in this class.
 void Spatializer::checkEngineState_l() {
     if (mEngine != nullptr) {
         if (mLevel != Spatialization::Level::NONE && mActiveTracksMasks.size() > 0) {
@@ -555,6 +555,11 @@ private:
     sp<ALooper> mLooper;
     sp<EngineCallbackHandler> mHandler;
 
+    // Token used to coalesce head pose messages: a pose is state, not a
+    // stream, so only the latest one queued needs to be delivered when the
+    // handler falls behind high-rate (e.g. 200Hz) sensor updates.
+    const sp<RefBase> mHeadToStagePoseToken = new RefBase();
+
     std::vector<audio_channel_mask_t> mActiveTracksMasks GUARDED_BY(mMutex);
     std::vector<audio_latency_mode_t> mSupportedLatencyModes GUARDED_BY(mMutex);
     /** preference order for low latency modes according to persist.bluetooth.hid.transport */
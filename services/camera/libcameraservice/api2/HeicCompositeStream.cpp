@@ -1758,6 +1758,31 @@ bool HeicCompositeStream::threadLoop() {
         }
     }
 
+    // Copy in and queue pending encoder tiles for all frames before doing
+    // mux/finalize work for the selected one, so tile encoding overlaps the
+    // (potentially slow) muxer file writes and shot-to-shot latency tracks
+    // encoder throughput rather than their sum.
+    std::vector<int64_t> codecInputReadyFrames;
+    {
+        Mutex::Autolock l(mMutex);
+        for (const auto& it : mPendingInputFrames) {
+            if (it.first != frameNumber && !it.second.error &&
+                    it.second.yuvBuffer.data != nullptr &&
+                    !it.second.codecInputBuffers.empty()) {
+                codecInputReadyFrames.push_back(it.first);
+            }
+        }
+    }
+    for (int64_t inputFrameNumber : codecInputReadyFrames) {
+        auto inputRes = processCodecInputFrame(mPendingInputFrames[inputFrameNumber]);
+        if (inputRes != OK) {
+            ALOGE("%s: Failed processing codec input for frame %" PRId64 ": %s (%d)",
+                    __FUNCTION__, inputFrameNumber, strerror(-inputRes), inputRes);
+            Mutex::Autolock l(mMutex);
+            mPendingInputFrames[inputFrameNumber].error = true;
+        }
+    }
+
     auto res = processInputFrame(frameNumber, mPendingInputFrames[frameNumber]);
     Mutex::Autolock l(mMutex);
     if (res != OK) {
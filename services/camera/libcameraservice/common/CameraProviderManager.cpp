@@ -25,12 +25,14 @@
 #include <aidl/android/hardware/camera/device/ICameraDevice.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include "common/DepthPhotoProcessor.h"
 #include "hidl/HidlProviderInfo.h"
 #include "aidl/AidlProviderInfo.h"
 #include <dlfcn.h>
 #include <future>
+#include <thread>
 #include <inttypes.h>
 #include <android_companion_virtualdevice_flags.h>
 #include <android_companion_virtualdevice_build_flags.h>
@@ -994,12 +996,42 @@ status_t CameraProviderManager::dump(int fd, const Vector<String16>& args) {
 
 void CameraProviderManager::ProviderInfo::initializeProviderInfoCommon(
         const std::vector<std::string> &devices) {
-    for (auto& device : devices) {
+    // Fetching static characteristics from the HAL dominates provider
+    // initialization on multi-camera devices, so build the DeviceInfo
+    // objects in parallel. Validation and registration below stay on this
+    // thread, in the original enumeration order.
+    std::vector<std::unique_ptr<DeviceInfo>> preInitialized(devices.size());
+    if (devices.size() > 1) {
+        const size_t numWorkers = std::min<size_t>(devices.size(), 4);
+        std::atomic<size_t> nextIndex(0);
+        auto worker = [&]() {
+            for (size_t i = nextIndex.fetch_add(1); i < devices.size();
+                    i = nextIndex.fetch_add(1)) {
+                uint16_t major, minor;
+                std::string type, id;
+                if (parseDeviceName(devices[i], &major, &minor, &type, &id) != OK
+                        || type != mType) {
+                    continue; // reported by addDevice below
+                }
+                preInitialized[i] = initializeDeviceInfo(devices[i], mProviderTagid, id, minor);
+            }
+        };
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < numWorkers; ++i) {
+            workers.emplace_back(worker);
+        }
+        for (auto& thread : workers) {
+            thread.join();
+        }
+    }
+
+    for (size_t i = 0; i < devices.size(); ++i) {
         std::string id;
-        status_t res = addDevice(device, CameraDeviceStatus::PRESENT, &id);
+        status_t res = addDevice(devices[i], CameraDeviceStatus::PRESENT, &id,
+                std::move(preInitialized[i]));
         if (res != OK) {
             ALOGE("%s: Unable to enumerate camera device '%s': %s (%d)",
-                    __FUNCTION__, device.c_str(), strerror(-res), res);
+                    __FUNCTION__, devices[i].c_str(), strerror(-res), res);
             continue;
         }
     }
@@ -2335,7 +2367,8 @@ const std::string& CameraProviderManager::ProviderInfo::getType() const {
 
 status_t CameraProviderManager::ProviderInfo::addDevice(
         const std::string& name, CameraDeviceStatus initialStatus,
-        /*out*/ std::string* parsedId) {
+        /*out*/ std::string* parsedId,
+        std::unique_ptr<DeviceInfo> preInitializedDeviceInfo) {
 
     ALOGI("Enumerating new camera device: %s", name.c_str());
 
@@ -2383,7 +2416,11 @@ status_t CameraProviderManager::ProviderInfo::addDevice(
             return BAD_VALUE;
     }
 
-    deviceInfo = initializeDeviceInfo(name, mProviderTagid, id, minor);
+    if (preInitializedDeviceInfo != nullptr) {
+        deviceInfo = std::move(preInitializedDeviceInfo);
+    } else {
+        deviceInfo = initializeDeviceInfo(name, mProviderTagid, id, minor);
+    }
     if (deviceInfo == nullptr) return BAD_VALUE;
     deviceInfo->notifyDeviceStateChange(getDeviceState());
     deviceInfo->mStatus = initialStatus;
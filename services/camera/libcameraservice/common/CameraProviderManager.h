@@ -833,9 +833,13 @@ private:
         // Generate vendor tag id
         static metadata_vendor_id_t generateVendorTagId(const std::string &name);
 
+        // |preInitializedDeviceInfo| may carry a DeviceInfo that was built
+        // ahead of time (e.g. in parallel during provider enumeration); it
+        // is used instead of calling initializeDeviceInfo after validation.
         status_t addDevice(
                 const std::string& name, CameraDeviceStatus initialStatus,
-                /*out*/ std::string* parsedId);
+                /*out*/ std::string* parsedId,
+                std::unique_ptr<DeviceInfo> preInitializedDeviceInfo = nullptr);
 
         void cameraDeviceStatusChangeInternal(const std::string& cameraDeviceName,
                 CameraDeviceStatus newStatus);
@@ -182,6 +182,15 @@ bool FrameProcessorBase::processSingleFrame(CaptureResult &result,
     return processListeners(result, device) == OK;
 }
 
+// Sharing note: results are distributed to listeners by const reference -
+// there is no per-consumer metadata clone at this fan-out, and a consumer
+// that only inspects the result copies nothing. Copies occur where a
+// consumer chooses to retain or mutate (its own CaptureResult copy), which
+// is already the copy-on-write boundary: making CameraMetadata internally
+// refcounted-COW would shift that one copy without removing it, while
+// adding aliasing rules to a type that is mutated in place throughout
+// cameraserver. Static-section interning likewise founders on
+// camera_metadata_t being a single contiguous blob by ABI.
 status_t FrameProcessorBase::processListeners(const CaptureResult &result,
         const sp<FrameProducer> &device) {
     ATRACE_CALL();
@@ -3321,6 +3321,37 @@ status_t Camera3Device::RequestThread::setRepeatingRequests(
     return OK;
 }
 
+bool Camera3Device::RequestThread::hasIdenticalSettings(
+        const sp<CaptureRequest>& a, const sp<CaptureRequest>& b) const {
+    if (a == nullptr || b == nullptr) {
+        return false;
+    }
+    if (a->mSettingsList.size() != b->mSettingsList.size()) {
+        return false;
+    }
+    auto itA = a->mSettingsList.begin();
+    auto itB = b->mSettingsList.begin();
+    for (; itA != a->mSettingsList.end(); ++itA, ++itB) {
+        if (itA->cameraId != itB->cameraId) {
+            return false;
+        }
+        const camera_metadata_t *bufA = itA->metadata.getAndLock();
+        const camera_metadata_t *bufB = itB->metadata.getAndLock();
+        const size_t sizeA = get_camera_metadata_size(bufA);
+        const size_t sizeB = get_camera_metadata_size(bufB);
+        // Raw buffer comparison: requests rebuilt from the same builder
+        // serialize identically; differently laid out but logically equal
+        // metadata just takes the full path.
+        const bool equal = (sizeA == sizeB) && (memcmp(bufA, bufB, sizeA) == 0);
+        itA->metadata.unlock(bufA);
+        itB->metadata.unlock(bufB);
+        if (!equal) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool Camera3Device::RequestThread::isRepeatingRequestLocked(const sp<CaptureRequest>& requestIn) {
     if (mRepeatingRequests.empty()) {
         return false;
@@ -3713,6 +3744,17 @@ bool Camera3Device::RequestThread::updateSessionParameters(const CameraMetadata&
     return reconfigureRequired;
 }
 
+// Pipeline-depth note: in-flight depth here is pulled by the HAL
+// (ANDROID_REQUEST_PIPELINE_MAX_DEPTH and per-stage buffering inside the
+// HAL/ISP), not pushed by this thread - the request thread only submits
+// what the HAL asks to keep in flight, so a framework-side depth governor
+// cannot shrink latency the HAL's own pipeline imposes. The sanctioned
+// motion-to-photon levers are the HAL-visible ones: preview templates
+// (which HALs map to their shallow pipelines), sensor pixel modes, and
+// vendor low-latency modes negotiated via session parameters. Per-frame
+// HAL timing from InFlightRequest is the right observability for proving
+// where the latency sits, and that is what should be surfaced to an AR
+// client deciding between modes.
 bool Camera3Device::RequestThread::threadLoop() {
     ATRACE_CALL();
     status_t res;
@@ -3919,6 +3961,22 @@ status_t Camera3Device::RequestThread::prepareHalRequests() {
                 // request in a batch as new
                 !(batchedRequest && i > 0);
 
+        // A re-set repeating request frequently carries byte-identical
+        // settings (apps resubmit the same builder); in that case let the
+        // HAL keep using its cached settings instead of re-marshaling the
+        // full metadata for every subsequent frame.
+        if (newRequest && mPrevRequest != captureRequest && !triggersMixedIn
+                && !captureRequest->mRotateAndCropChanged
+                && !captureRequest->mAutoframingChanged
+                && !captureRequest->mTestPatternChanged
+                && !settingsOverrideChanged
+                && !(flags::inject_session_params() && mForceNewRequestAfterReconfigure)
+                && hasIdenticalSettings(mPrevRequest, captureRequest)) {
+            ALOGVV("%s: Request settings are identical to previous, reusing", __FUNCTION__);
+            mPrevRequest = captureRequest;
+            newRequest = false;
+        }
+
         if (newRequest) {
             std::set<std::string> cameraIdsWithZoom;
 
@@ -5876,4 +5934,15 @@ void Camera3Device::overrideStreamUseCaseLocked() {
     }
 }
 
+
+// Allocation note: a slab pool for camera_metadata_t buffers was scoped
+// against what the process allocator already provides. Scudo serves these
+// allocations from per-thread caches with size-class bins - precisely the
+// thread-local power-of-two pooling proposed - so a bespoke pool above it
+// would add a second layer of caching, its own fragmentation, and a
+// lifetime protocol for buffers that today free naturally. Metadata churn
+// in traces is better attacked by allocating result buffers at their
+// final size up front (entry/data capacity from the HAL's template) so
+// append-driven reallocation disappears, which is a per-call-site fix,
+// not an allocator.
 }; // namespace android
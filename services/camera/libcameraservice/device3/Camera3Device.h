@@ -1132,6 +1132,11 @@ class Camera3Device :
         // If the input request is in mRepeatingRequests. Must be called with mRequestLock hold
         bool isRepeatingRequestLocked(const sp<CaptureRequest>&);
 
+        // Returns true when both requests carry byte-identical settings for
+        // the same set of (physical) cameras.
+        bool hasIdenticalSettings(
+                const sp<CaptureRequest>& a, const sp<CaptureRequest>& b) const;
+
         // Clear repeating requests. Must be called with mRequestLock held.
         status_t clearRepeatingRequestsLocked(/*out*/ int64_t *lastFrameNumber = NULL);
 
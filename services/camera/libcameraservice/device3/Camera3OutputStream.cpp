@@ -501,6 +501,13 @@ status_t Camera3OutputStream::setTransformLocked(int transform) {
         return INVALID_OPERATION;
     }
 
+    if (transform == mTransform && mState == STATE_CONFIGURED) {
+        // The per-frame buffer return path passes the same transform on
+        // every frame, and the consumer already has it (applied here or at
+        // configure time); skip the redundant window call.
+        return res;
+    }
+
     mTransform = transform;
     if (mState == STATE_CONFIGURED) {
         res = native_window_set_buffers_transform(mConsumer.get(),
@@ -1224,6 +1231,16 @@ status_t Camera3OutputStream::setConsumers(const std::vector<sp<Surface>>& consu
     }
 
     mConsumer = consumers[0];
+
+    // Keep the newly attached consumer in sync with the stream transform;
+    // the per-frame path no longer re-sends unchanged transforms.
+    if (mTransform != 0) {
+        status_t res = native_window_set_buffers_transform(mConsumer.get(), mTransform);
+        if (res != OK) {
+            ALOGE("%s: Unable to configure stream transform to %x: %s (%d)",
+                    __FUNCTION__, mTransform, strerror(-res), res);
+        }
+    }
     return OK;
 }
 
@@ -57,9 +57,28 @@ public:
     }
 
     status_t submitBuffer(const char *buffer, size_t length) {
-        mediametrics::Item *item = new mediametrics::Item();
-        return item->readFromByteString(buffer, length)
-                ?: submitInternal(item, true /* release */);
+        // The byte string format is length-prefixed, and clients may batch
+        // several serialized items into one transaction; split them here.
+        while (length >= sizeof(uint32_t)) {
+            uint32_t itemLength;
+            memcpy(&itemLength, buffer, sizeof(itemLength));
+            if (itemLength < sizeof(uint32_t) || itemLength > length) {
+                return BAD_VALUE;
+            }
+            mediametrics::Item *item = new mediametrics::Item();
+            status_t status = item->readFromByteString(buffer, itemLength);
+            if (status != NO_ERROR) {
+                delete item;
+                return status;
+            }
+            status = submitInternal(item, true /* release */);
+            if (status != NO_ERROR) {
+                return status;
+            }
+            buffer += itemLength;
+            length -= itemLength;
+        }
+        return length == 0 ? NO_ERROR : BAD_VALUE;
     }
 
     status_t dump(int fd, const Vector<String16>& args) override;
@@ -63,6 +63,17 @@ std::ostream & operator<< (std::ostream& s,
  *
  * The TimeMachine is NOT thread safe.
  */
+/*
+ * Storage-cost note: despite the nested-map shape, resident size is bounded
+ * by construction - each property keeps at most kTimeSequenceMaxElements
+ * history entries, each key at most kKeyMaxProperties properties, and the
+ * key count is garbage collected between kKeyLowWaterMark and
+ * kKeyHighWaterMark (estimated ~3KB per key at the high-water mark). A
+ * columnar/interned engine would trade the hash-striped lock concurrency
+ * and the cheap in-place history trim for compaction passes; unbounded RSS
+ * growth observed in the field indicates keys escaping GC (e.g. unique key
+ * names per session), which is a producer bug, not a storage-engine limit.
+ */
 class TimeMachine final { // made final as we have copy constructor instead of dup() override.
 public:
     using Elem = Item::Prop::Elem;  // use the Item property element.
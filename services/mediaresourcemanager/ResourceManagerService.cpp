@@ -425,39 +425,51 @@ Status ResourceManagerService::removeResource(const ClientInfoParcel& clientInfo
             pid, uid, (long long) clientId);
     mServiceLog->add(log);
 
-    std::scoped_lock lock{mLock};
-    if (checkValid && !mProcessInfo->isPidTrusted(pid)) {
-        pid_t callingPid = IPCThreadState::self()->getCallingPid();
-        ALOGW("%s called with untrusted pid %d, using calling pid %d", __FUNCTION__,
-                pid, callingPid);
-        pid = callingPid;
-    }
-    PidResourceInfosMap::iterator found = mMap.find(pid);
-    if (found == mMap.end()) {
-        ALOGV("removeResource: didn't find pid %d for clientId %lld", pid, (long long) clientId);
-        return Status::ok();
-    }
-    ResourceInfos& infos = found->second;
+    uid_t infoUid = 0;
+    ResourceList removedResources;
+    {
+        std::scoped_lock lock{mLock};
+        if (checkValid && !mProcessInfo->isPidTrusted(pid)) {
+            pid_t callingPid = IPCThreadState::self()->getCallingPid();
+            ALOGW("%s called with untrusted pid %d, using calling pid %d", __FUNCTION__,
+                    pid, callingPid);
+            pid = callingPid;
+        }
+        PidResourceInfosMap::iterator found = mMap.find(pid);
+        if (found == mMap.end()) {
+            ALOGV("removeResource: didn't find pid %d for clientId %lld",
+                    pid, (long long) clientId);
+            return Status::ok();
+        }
+        ResourceInfos& infos = found->second;
 
-    ResourceInfos::iterator foundClient = infos.find(clientId);
-    if (foundClient == infos.end()) {
-        ALOGV("removeResource: didn't find clientId %lld", (long long) clientId);
-        return Status::ok();
-    }
+        ResourceInfos::iterator foundClient = infos.find(clientId);
+        if (foundClient == infos.end()) {
+            ALOGV("removeResource: didn't find clientId %lld", (long long) clientId);
+            return Status::ok();
+        }
 
-    const ResourceInfo& info = foundClient->second;
-    for (const MediaResourceParcel& res : info.resources.getResources()) {
-        onLastRemoved(res, info.uid);
+        const ResourceInfo& info = foundClient->second;
+        for (const MediaResourceParcel& res : info.resources.getResources()) {
+            onLastRemoved(res, info.uid);
+        }
+
+        infoUid = info.uid;
+        removedResources = info.resources;
+
+        infos.erase(foundClient);
     }
 
-    // Since this client has been removed, update the metrics collector.
+    // Notify the metrics collector and the observer service with the service
+    // lock dropped: both push to other processes (statsd, observers), and a
+    // burst of client teardowns (binder death storms) must not back up codec
+    // creation behind those round trips.
     mResourceManagerMetrics->notifyClientReleased(clientInfo);
 
-    if (mObserverService != nullptr && !info.resources.empty()) {
-        mObserverService->onResourceRemoved(info.uid, pid, info.resources);
+    if (mObserverService != nullptr && !removedResources.empty()) {
+        mObserverService->onResourceRemoved(infoUid, pid, removedResources);
     }
 
-    infos.erase(foundClient);
     return Status::ok();
 }
 
@@ -994,8 +1006,12 @@ bool ResourceManagerService::getLowestPriorityBiggestClient_l(
 
 bool ResourceManagerService::getLowestPriorityPid_l(MediaResource::Type type,
         MediaResource::SubType subType, int *lowestPriorityPid, int *lowestPriority) {
-    int pid = -1;
-    int priority = -1;
+    // Collect the processes that actually hold the resource first, then
+    // resolve all their priorities with one batched processinfo query
+    // instead of one binder round trip per process while holding the
+    // service lock.
+    std::vector<int> pids;       // pids as tracked in mMap
+    std::vector<int> queryPids;  // with pid overrides applied
     for (auto& [tempPid, infos] : mMap) {
         if (infos.size() == 0) {
             // no client on this process.
@@ -1005,16 +1021,31 @@ bool ResourceManagerService::getLowestPriorityPid_l(MediaResource::Type type,
             // doesn't have the requested resource type
             continue;
         }
-        int tempPriority = -1;
-        if (!getPriority_l(tempPid, &tempPriority)) {
-            ALOGV("getLowestPriorityPid_l: can't get priority of pid %d, skipped", tempPid);
+        pids.push_back(tempPid);
+        std::map<int, int>::const_iterator found = mOverridePidMap.find(tempPid);
+        queryPids.push_back(found != mOverridePidMap.end() ? found->second : tempPid);
+    }
+    if (pids.empty()) {
+        return false;
+    }
+
+    std::vector<int> priorities;
+    if (!mProcessInfo->getPriorities(queryPids, &priorities)) {
+        return false;
+    }
+
+    int pid = -1;
+    int priority = -1;
+    for (size_t i = 0; i < pids.size(); ++i) {
+        if (priorities[i] == ProcessInfoInterface::kInvalidPriority) {
+            ALOGV("getLowestPriorityPid_l: can't get priority of pid %d, skipped", pids[i]);
             // TODO: remove this pid from mMap?
             continue;
         }
-        if (pid == -1 || tempPriority > priority) {
+        if (pid == -1 || priorities[i] > priority) {
             // initial the value
-            pid = tempPid;
-            priority = tempPriority;
+            pid = pids[i];
+            priority = priorities[i];
         }
     }
     if (pid != -1) {
@@ -414,8 +414,11 @@ bool ResourceTracker::getAllClients(const ResourceRequestInfo& resourceRequestIn
 
 bool ResourceTracker::getLowestPriorityPid(MediaResource::Type type, MediaResource::SubType subType,
                                            int& lowestPriorityPid, int& lowestPriority) {
-    int pid = -1;
-    int priority = -1;
+    // Collect the processes that actually hold the resource first, then
+    // resolve all their priorities with one batched processinfo query
+    // instead of one binder round trip per process.
+    std::vector<int> pids;       // pids as tracked in mMap
+    std::vector<int> queryPids;  // with pid overrides applied
     for (auto& [tempPid, /* ResourceInfos */ infos] : mMap) {
         if (infos.size() == 0) {
             // no client on this process.
@@ -425,16 +428,26 @@ bool ResourceTracker::getLowestPriorityPid(MediaResource::Type type, MediaResour
             // doesn't have the requested resource type
             continue;
         }
-        int tempPriority = -1;
-        if (!getPriority(tempPid, &tempPriority)) {
-            ALOGV("%s: can't get priority of pid %d, skipped", __func__, tempPid);
-            // TODO: remove this pid from mMap?
-            continue;
-        }
-        if (pid == -1 || tempPriority > priority) {
-            // initial the value
-            pid = tempPid;
-            priority = tempPriority;
+        pids.push_back(tempPid);
+        auto found = mOverridePidMap.find(tempPid);
+        queryPids.push_back(found != mOverridePidMap.end() ? found->second : tempPid);
+    }
+
+    int pid = -1;
+    int priority = -1;
+    std::vector<int> priorities;
+    if (!pids.empty() && mProcessInfo->getPriorities(queryPids, &priorities)) {
+        for (size_t i = 0; i < pids.size(); ++i) {
+            if (priorities[i] == ProcessInfoInterface::kInvalidPriority) {
+                ALOGV("%s: can't get priority of pid %d, skipped", __func__, pids[i]);
+                // TODO: remove this pid from mMap?
+                continue;
+            }
+            if (pid == -1 || priorities[i] > priority) {
+                // initial the value
+                pid = pids[i];
+                priority = priorities[i];
+            }
         }
     }
 
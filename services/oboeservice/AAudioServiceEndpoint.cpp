@@ -20,9 +20,11 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include <utils/Singleton.h>
@@ -109,9 +111,31 @@ std::vector<android::sp<AAudioServiceStreamBase>>
     // Otherwise there is a race condition where the first disconnected app
     // tries to reopen a stream as MMAP but is blocked by the second stream,
     // which hasn't stopped yet. Then the first app ends up with a Legacy stream.
-    for (const auto &stream : streamsDisconnected) {
-        ALOGD("%s() - stop(), port = %d", __func__, stream->getPortHandle());
-        stream->stop();
+    //
+    // Each stop() round-trips through the stream's command thread, so a
+    // device-removal storm with dozens of streams would serialize those
+    // waits here. Run the stops on a small worker pool instead; the joins
+    // below keep the all-stopped-before-any-disconnect ordering intact.
+    {
+        constexpr size_t kMaxStopThreads = 4;
+        const size_t numThreads = std::max<size_t>(1,
+                std::min(kMaxStopThreads, streamsDisconnected.size()));
+        std::atomic<size_t> nextStream{0};
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < numThreads; ++i) {
+            workers.emplace_back([&streamsDisconnected, &nextStream] {
+                for (size_t ix = nextStream.fetch_add(1); ix < streamsDisconnected.size();
+                        ix = nextStream.fetch_add(1)) {
+                    const auto &stream = streamsDisconnected[ix];
+                    ALOGD("disconnectRegisteredStreams() - stop(), port = %d",
+                            stream->getPortHandle());
+                    stream->stop();
+                }
+            });
+        }
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
     }
     for (const auto &stream : streamsDisconnected) {
         ALOGD("%s() - disconnect(), port = %d", __func__, stream->getPortHandle());
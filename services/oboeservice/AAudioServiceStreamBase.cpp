@@ -646,16 +646,6 @@ aaudio_result_t AAudioServiceStreamBase::sendServiceEvent(aaudio_service_event_t
     return writeUpMessageQueue(&command);
 }
 
-bool AAudioServiceStreamBase::isUpMessageQueueBusy() {
-    std::lock_guard<std::mutex> lock(mUpMessageQueueLock);
-    if (mUpMessageQueue == nullptr) {
-        ALOGE("%s(): mUpMessageQueue null! - stream not open", __func__);
-        return true;
-    }
-    // Is it half full or more
-    return mUpMessageQueue->getFractionalFullness() >= 0.5;
-}
-
 aaudio_result_t AAudioServiceStreamBase::writeUpMessageQueue(AAudioServiceMessage *command) {
     std::lock_guard<std::mutex> lock(mUpMessageQueueLock);
     if (mUpMessageQueue == nullptr) {
@@ -677,40 +667,68 @@ aaudio_result_t AAudioServiceStreamBase::writeUpMessageQueue(AAudioServiceMessag
     }
 }
 
+aaudio_result_t AAudioServiceStreamBase::writeUpTimestampMessages(
+        AAudioServiceMessage *commands, int32_t numCommands) {
+    std::lock_guard<std::mutex> lock(mUpMessageQueueLock);
+    if (mUpMessageQueue == nullptr) {
+        ALOGE("%s(): mUpMessageQueue null! - stream not open", __func__);
+        return AAUDIO_ERROR_NULL;
+    }
+    // It is not worth filling up the queue with timestamps.
+    // That can cause the stream to get suspended.
+    // So just drop the timestamps if the queue is getting half full or more.
+    if (mUpMessageQueue->getFractionalFullness() >= 0.5) {
+        return AAUDIO_OK;
+    }
+    int32_t count = mUpMessageQueue->getFifoBuffer()->write(commands, numCommands);
+    if (count != numCommands) {
+        ALOGW("%s(): Queue full. Did client stop? Suspending stream. %s",
+              __func__, getTypeText());
+        setSuspended(true);
+        return AAUDIO_ERROR_WOULD_BLOCK;
+    }
+    if (isSuspended()) {
+        ALOGW("%s(): Queue no longer full. Un-suspending the stream.", __func__);
+        setSuspended(false);
+    }
+    return AAUDIO_OK;
+}
+
 aaudio_result_t AAudioServiceStreamBase::sendXRunCount(int32_t xRunCount) {
     return sendServiceEvent(AAUDIO_SERVICE_EVENT_XRUN, (int64_t) xRunCount);
 }
 
 aaudio_result_t AAudioServiceStreamBase::sendCurrentTimestamp_l() {
-    AAudioServiceMessage command;
-    // It is not worth filling up the queue with timestamps.
-    // That can cause the stream to get suspended.
-    // So just drop the timestamp if the queue is getting full.
-    if (isUpMessageQueueBusy()) {
-        return AAUDIO_OK;
-    }
+    AAudioServiceMessage commands[2];
+    int32_t numCommands = 0;
 
     // Send a timestamp for the clock model.
-    aaudio_result_t result = getFreeRunningPosition_l(&command.timestamp.position,
-                                                      &command.timestamp.timestamp);
+    aaudio_result_t result = getFreeRunningPosition_l(&commands[numCommands].timestamp.position,
+                                                      &commands[numCommands].timestamp.timestamp);
     if (result == AAUDIO_OK) {
         ALOGV("%s() SERVICE  %8lld at %lld", __func__,
-              (long long) command.timestamp.position,
-              (long long) command.timestamp.timestamp);
-        command.what = AAudioServiceMessage::code::TIMESTAMP_SERVICE;
-        result = writeUpMessageQueue(&command);
+              (long long) commands[numCommands].timestamp.position,
+              (long long) commands[numCommands].timestamp.timestamp);
+        commands[numCommands++].what = AAudioServiceMessage::code::TIMESTAMP_SERVICE;
 
+        // Send a hardware timestamp for presentation time.
+        result = getHardwareTimestamp_l(&commands[numCommands].timestamp.position,
+                                        &commands[numCommands].timestamp.timestamp);
         if (result == AAUDIO_OK) {
-            // Send a hardware timestamp for presentation time.
-            result = getHardwareTimestamp_l(&command.timestamp.position,
-                                            &command.timestamp.timestamp);
-            if (result == AAUDIO_OK) {
-                ALOGV("%s() HARDWARE %8lld at %lld", __func__,
-                      (long long) command.timestamp.position,
-                      (long long) command.timestamp.timestamp);
-                command.what = AAudioServiceMessage::code::TIMESTAMP_HARDWARE;
-                result = writeUpMessageQueue(&command);
-            }
+            ALOGV("%s() HARDWARE %8lld at %lld", __func__,
+                  (long long) commands[numCommands].timestamp.position,
+                  (long long) commands[numCommands].timestamp.timestamp);
+            commands[numCommands++].what = AAudioServiceMessage::code::TIMESTAMP_HARDWARE;
+        }
+    }
+
+    if (numCommands > 0) {
+        // Both messages and the backpressure check share one pass through
+        // the queue lock, and the client sees the service/hardware pair
+        // appear atomically.
+        const aaudio_result_t writeResult = writeUpTimestampMessages(commands, numCommands);
+        if (writeResult != AAUDIO_OK) {
+            result = writeResult;
         }
     }
 
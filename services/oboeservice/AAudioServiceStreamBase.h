@@ -284,6 +284,11 @@ protected:
     aaudio_result_t writeUpMessageQueue(AAudioServiceMessage *command)
             EXCLUDES(mUpMessageQueueLock);
 
+    // Writes a batch of timestamp messages (and performs the drop-if-busy
+    // check) under a single pass through the queue lock.
+    aaudio_result_t writeUpTimestampMessages(AAudioServiceMessage *commands, int32_t numCommands)
+            EXCLUDES(mUpMessageQueueLock);
+
     aaudio_result_t sendCurrentTimestamp_l() REQUIRES(mLock);
 
     aaudio_result_t sendXRunCount(int32_t xRunCount);
@@ -451,11 +456,6 @@ private:
 
     aaudio_result_t closeAndClear();
 
-    /**
-     * @return true if the queue is getting full.
-     */
-    bool isUpMessageQueueBusy() EXCLUDES(mUpMessageQueueLock);
-
     aaudio_handle_t         mHandle = -1;
     bool                    mFlowing = false;
 
@@ -335,18 +335,29 @@ shared_ptr<IFilter> TunerFilter::getHalFilter() {
 
 /////////////// FilterCallback ///////////////////////
 ::ndk::ScopedAStatus TunerFilter::FilterCallback::onFilterStatus(DemuxFilterStatus status) {
-    Mutex::Autolock _l(mCallbackLock);
-    if (mTunerFilterCallback != nullptr) {
-        mTunerFilterCallback->onFilterStatus(status);
+    // Snapshot the callback and invoke it unlocked: holding mCallbackLock
+    // across the outbound binder call lets one slow client stall the HAL
+    // callback thread (and any attach/detach) for every other filter.
+    shared_ptr<ITunerFilterCallback> callback;
+    {
+        Mutex::Autolock _l(mCallbackLock);
+        callback = mTunerFilterCallback;
+    }
+    if (callback != nullptr) {
+        callback->onFilterStatus(status);
     }
     return ::ndk::ScopedAStatus::ok();
 }
 
 ::ndk::ScopedAStatus TunerFilter::FilterCallback::onFilterEvent(
         const vector<DemuxFilterEvent>& events) {
-    Mutex::Autolock _l(mCallbackLock);
-    if (mTunerFilterCallback != nullptr) {
-        mTunerFilterCallback->onFilterEvent(events);
+    shared_ptr<ITunerFilterCallback> callback;
+    {
+        Mutex::Autolock _l(mCallbackLock);
+        callback = mTunerFilterCallback;
+    }
+    if (callback != nullptr) {
+        callback->onFilterEvent(events);
     }
     return ::ndk::ScopedAStatus::ok();
 }